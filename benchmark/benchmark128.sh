@@ -0,0 +1,35 @@
+#!/bin/sh
+# Compares the two implementations of the 128-bit version on fixed inputs.
+# Run it with `make benchmark128` from the root of the repository. For every
+# combination of options and input the smallest running time out of REPEATS
+# runs, as reported by the program, is printed.
+#
+# dense128.g6 contains 20 random graphs G(n, 1/2) with 64 <= n < 127 and
+# cubic128.g6 contains 5 random cubic graphs with 64 <= n < 100.
+
+REPEATS=${REPEATS:-3}
+BINARIES="circumferenceChecker-128 circumferenceChecker-128-int"
+
+run() {
+    options=$1
+    input=$2
+    for binary in $BINARIES; do
+        best=""
+        i=0
+        while [ $i -lt $REPEATS ]; do
+            time=$(./$binary $options < $input 2>&1 >/dev/null |
+             sed -n 's/.* in \([0-9.]*\) seconds.*/\1/p')
+            best=$(printf '%s\n%s\n' "$best" "$time" | sed '/^$/d' | sort -g |
+             head -n 1)
+            i=$((i + 1))
+        done
+        printf '%-30s %-8s %-26s %10s s\n' "$binary" "$options" "$input" "$best"
+    done
+}
+
+run "-H" benchmark/cubic128.g6
+run "-l" benchmark/cubic128.g6
+run "-c" benchmark/cubic128.g6
+run "-c" benchmark/dense128.g6
+run "-p" benchmark/dense128.g6
+run "-G -c" benchmark/dense128.g6
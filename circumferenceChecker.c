@@ -19,7 +19,7 @@
  *
  */
 
-#define USAGE "Usage: ./circumferenceChecker [-cf#|-pf#|-l] [-Cdo#] [-h]"
+#define USAGE "Usage: ./circumferenceChecker [-cf#|-pf#|-l|-B|-1|-2] [-CdGo#sSt#x] [-k#DT#] [-h]"
 
 #define HELPTEXT \
 "Count and or filter graphs depending on their circumference, length,\n\
@@ -32,6 +32,26 @@ output graph (if it passes through the filter).\n\
 If no options are passed the program will compute the circumference of\n\
 the input graphs.\n\
 \n\
+Every version handles graphs up to a fixed order: 63 vertices for the\n\
+64 bit version, 127 for the 128 bit version, etc. The large version handles\n\
+up to 1023 vertices unless it is compiled with make large largeWords=#,\n\
+then up to 64 * # - 1. Larger graphs are skipped with the message\n\
+\"Skipping invalid graph!\".\n\
+\n\
+    -1, --k1-hamiltonian\n\
+            decide whether the graph is K1-hamiltonian, i.e. G - v is\n\
+            hamiltonian for every vertex v. The table contains 1 for\n\
+            K1-hamiltonian graphs and 0 otherwise, by default the\n\
+            K1-hamiltonian graphs are sent to stdout.\n\
+    -2, --k2-hamiltonian\n\
+            decide whether the graph is K2-hamiltonian, i.e. G - v - w is\n\
+            hamiltonian for every edge vw. The table and output are as for\n\
+            -1.\n\
+    -B, --berge\n\
+            decide whether the graph is Berge, i.e. contains no induced cycle\n\
+            of odd length at least 5 and no complement of one. The table\n\
+            contains 1 for Berge graphs and 0 otherwise, by default the Berge\n\
+            graphs are sent to stdout.\n\
     -c, --induced-cycle\n\
             count the longest induced cycle of each graph and print in a table.\n\
     -C, --complement\n\
@@ -43,8 +63,22 @@ the input graphs.\n\
             send all graphs to stdout that contain an induced path or cycle\n\
             of length # depending on the presence of -c or -p. Length of path\n\
             is the number of edges.\n\
+    -G, --complement-graph\n\
+            do all computations on the complement of each graph. The graphs\n\
+            sent to stdout are still the input graphs.\n\
+    -D, --deterministic\n\
+            use a fixed seed for the random colorings of -k#, so that the\n\
+            results are reproducible.\n\
     -h, --help\n\
             print help message.\n\
+    -k#, --color-coding=#\n\
+            decide by color coding whether the graph contains a cycle of\n\
+            length # or, if -l is present, a path of length #. The table\n\
+            contains 1 if it was found and 0 otherwise, by default graphs\n\
+            with value 1 are sent to stdout. A found cycle or path always\n\
+            exists, by default one which exists is missed with probability\n\
+            at most e^-7 per graph (about 0.1%). The number of colorings\n\
+            tried per graph is printed to stderr, see -T#.\n\
     -l, --length\n\
             find the length of each graph, i.e. the number of edges in a\n\
             longest path, and print in a table.\n\
@@ -54,7 +88,34 @@ the input graphs.\n\
             count the longest induced path of each graph and print in a table.\n\
     -h, --hamiltonian\n\
             when computing circumference (length), do a hamiltonicity\n\
-            (traceability) check first\n"
+            (traceability) check first\n\
+    -s, --spectrum\n\
+            with -c or -p, send each graph to stdout followed by the lengths\n\
+            of all its induced cycles or paths, and print for each length how\n\
+            many graphs do and do not contain it. With -o# or -f# only the\n\
+            graphs passing the filter are sent to stdout.\n\
+    -S, --symmetry\n\
+            when computing circumference, compute the orbits of the\n\
+            automorphism group and only start the search for cycles in one\n\
+            vertex of each orbit.\n\
+    -t#, --treewidth=#\n\
+            compute circumference (length) by dynamic programming over a\n\
+            tree decomposition if the graph has at least 40 vertices and a\n\
+            decomposition of width at most # is found. At most 9, default\n\
+            5, larger widths are usually slower than the search. A\n\
+            negative value disables this.\n\
+    -T#, --trials=#\n\
+            number of random colorings tried by -k#. By default this is\n\
+            7k^k/k! for paths or cycles with k vertices, i.e. k = # for\n\
+            cycles and k = # + 1 for paths, e.g. about 19k colorings for\n\
+            cycles of length 10, 50k for 11 and 130k for 12. Each coloring\n\
+            costs time proportional to 2^k, so -T# has to be given if k is\n\
+            larger than 12.\n\
+    -x, --certificates\n\
+            with -1 or -2, turn every hamiltonian cycle found in G - v (or\n\
+            G - v - w) into cycles certifying other vertices (or edges) by\n\
+            swapping vertices, and only search for hamiltonian cycles of the\n\
+            vertex- or edge-deleted subgraphs which are not yet certified.\n"
 
 
 #include <stdio.h>
@@ -66,6 +127,24 @@ the input graphs.\n\
 #include "libs/bitset.h"
 #include "libs/readGraph6.h"
 #include "libs/hamiltonicityMethods.h"
+#include "libs/treeDecomposition.h"
+#include "libs/colorCoding.h"
+#include "libs/automorphisms.h"
+#include "libs/recognitionMethods.h"
+
+#ifdef USE_LARGE_BIT
+#include <pthread.h>
+
+// Number of words of the bitsets which are used for the current graph.
+int bitsetWords = BITSET_WORDS;
+
+//  The searches for paths and cycles recurse once per vertex on the path and
+//  keep about ten bitsets per call, e.g. -B on a cycle of 4095 vertices needs
+//  19 MiB with 64 words. The graphs are checked on a thread with this stack
+//  size, since the default of 8 MiB is too small for the larger versions.
+#define SEARCH_STACK_SIZE \
+ ((size_t) 8 * 1024 * 1024 + (size_t) 32 * BITSETSIZE * sizeof(bitset))
+#endif
 
 struct graph {
     bitset *adjacencyList;
@@ -81,6 +160,30 @@ struct options {
     bool hamiltonianCheck;
     int forbiddenLength;
     int output;
+    int treeWidthThreshold;
+    int colorCodingLength;
+    long long int colorCodingTrials;
+    bool deterministicFlag;
+    bool symmetryFlag;
+    bool spectrumFlag;
+    bool bergeFlag;
+    bool complementGraphFlag;
+    int kHamiltonicity;
+    bool certificateFlag;
+};
+
+//  Totals over all checked graphs. The arrays are indexed by the values in the
+//  table and are allocated by main, so that they are shared by all versions of
+//  processGraph when several are linked into one binary.
+struct statistics {
+    unsigned long long int counter;
+    unsigned long long int skippedGraphs;
+    unsigned long long int passedGraphs;
+    unsigned long long int *frequencies;
+    unsigned long long int *graphsWithLength;
+
+    // State of the random number generator used by color coding.
+    unsigned long long int seed;
 };
 
 void printGraph(struct graph *g) {
@@ -94,6 +197,66 @@ void printGraph(struct graph *g) {
     fprintf(stderr, "\n");
 }
 
+//******************************************************************************
+//
+//                              Witness cache
+//
+//******************************************************************************
+
+// Consecutive input graphs are often closely related, so a longest cycle or
+// path of a recent graph often still exists in the next one. Its length is
+// then a lower bound for the current graph.
+#define WITNESS_CACHE_SIZE 8
+
+struct witnessCache {
+    int witnesses[WITNESS_CACHE_SIZE][BITSETSIZE];
+    int orders[WITNESS_CACHE_SIZE];
+    int numberOfWitnesses;
+    int oldestWitness;
+};
+
+// Stores a cycle or path of the given order, replacing the oldest witness if
+// the cache is full.
+void addWitness(struct witnessCache *cache, int vertices[], int order) {
+    int index = cache->oldestWitness;
+    cache->oldestWitness = (cache->oldestWitness + 1) % WITNESS_CACHE_SIZE;
+    if(cache->numberOfWitnesses < WITNESS_CACHE_SIZE) {
+        cache->numberOfWitnesses++;
+    }
+    for(int i = 0; i < order; i++) {
+        cache->witnesses[index][i] = vertices[i];
+    }
+    cache->orders[index] = order;
+}
+
+// Returns the largest order of a cached witness which is a cycle of the graph
+// if isCycle is true or a path otherwise. Returns 0 if there is none.
+int getWitnessLowerBound(struct graph *g, struct witnessCache *cache, bool
+isCycle) {
+    int lowerBound = 0;
+    for(int i = 0; i < cache->numberOfWitnesses; i++) {
+        int order = cache->orders[i];
+        int *witness = cache->witnesses[i];
+        if(order <= lowerBound || order > g->nv) continue;
+
+        bool isWitness = true;
+        for(int j = 0; j < order && isWitness; j++) {
+            if(witness[j] >= g->nv) isWitness = false;
+        }
+        for(int j = 1; j < order && isWitness; j++) {
+            if(!contains(g->adjacencyList[witness[j - 1]], witness[j])) {
+                isWitness = false;
+            }
+        }
+        if(isWitness && isCycle &&
+         !contains(g->adjacencyList[witness[order - 1]], witness[0])) {
+            isWitness = false;
+        }
+        if(isWitness) lowerBound = order;
+    }
+    return lowerBound;
+}
+
 //******************************************************************************
 //
 //                   Methods for circumference checker
@@ -101,7 +264,8 @@ void printGraph(struct graph *g) {
 //******************************************************************************
 
 bool canBeCycleOfLength(struct graph *g, bitset remainingVertices, int
-lastElemOfPath, int firstElemOfPath, int cycleLength, int pathLength) {
+pathList[], int lastElemOfPath, int firstElemOfPath, int cycleLength, int
+pathLength) {
 
     // Check if current path is a cycle of the required length.
     if((pathLength == cycleLength) &&
@@ -109,6 +273,22 @@ lastElemOfPath, int firstElemOfPath, int cycleLength, int pathLength) {
         return true;
     }
 
+    // A longer path cannot become a cycle of the required length.
+    if(pathLength == cycleLength) return false;
+
+    // Remaining vertices with less than two neighbours which are remaining
+    // vertices or endpoints of the path cannot lie on the cycle. Only the
+    // neighbours of the previous last element are checked, their degree
+    // decreased since it became an inner vertex of the path. If too few
+    // vertices are left, the path cannot become a cycle of the required
+    // length.
+    remainingVertices = difference(remainingVertices,
+     getVerticesWithLowDegreeIn(g->adjacencyList,
+     intersection(g->adjacencyList[pathList[pathLength - 2]],
+     remainingVertices), union(remainingVertices,
+     union(singleton(firstElemOfPath), singleton(lastElemOfPath)))));
+    if(pathLength + size(remainingVertices) < cycleLength) return false;
+
     // If start of path cannot be closed, path cannot become a cycle.
     if(isEmpty(intersection(g->adjacencyList[firstElemOfPath],
      remainingVertices))) { 
@@ -123,8 +303,9 @@ lastElemOfPath, int firstElemOfPath, int cycleLength, int pathLength) {
 
         removeElement(remainingVertices, neighbour);
         lastElemOfPath = neighbour; // Neighbour is the new last element.
+        pathList[pathLength] = neighbour;
 
-        if (canBeCycleOfLength(g, remainingVertices, lastElemOfPath, 
+        if (canBeCycleOfLength(g, remainingVertices, pathList, lastElemOfPath,
          firstElemOfPath, cycleLength, pathLength + 1)) {
             return true;
         }
@@ -157,7 +338,95 @@ int findLowestDegreeVertex(struct graph *g, bitset includedVertices) {
     return start;
 }
 
-int getCircumference(struct graph *g, struct options *options, bitset excludedVertices) {
+// Checks whether the path uvw in the subgraph spanned by includedVertices can
+// be extended to a cycle of the given length. If so, the cycle is stored in
+// pathList.
+bool canBeCycleThroughPath(struct graph *g, bitset includedVertices, int
+pathList[], int u, int v, int w, int cycleLength) {
+    bitset path = singleton(v);
+    add(path, u);
+    add(path, w);
+    bitset remainingVertices = difference(includedVertices, path);
+
+    // Remaining vertices with less than two neighbours which are remaining
+    // vertices or endpoints of the path cannot lie on the cycle. During the
+    // search only the vertices whose degree changed are checked again.
+    remainingVertices = intersection(remainingVertices,
+     getVerticesWithTwoNeighboursIn(g->adjacencyList, union(remainingVertices,
+     union(singleton(u), singleton(w)))));
+
+    pathList[0] = w;
+    pathList[1] = v;
+    pathList[2] = u;
+    return canBeCycleOfLength(g, remainingVertices, pathList, u, w,
+     cycleLength, 3);
+}
+
+// Returns the number of vertices in the 2-core of the graph, i.e. the
+// vertices remaining after repeatedly removing vertices of degree at most 1.
+// Only these vertices can lie on a cycle.
+int getCircumferenceUpperBound(struct graph *g) {
+    bitset core = complement(EMPTY, g->nv);
+    bool removedVertex = true;
+    while(removedVertex) {
+        removedVertex = false;
+        forEach(v, core) {
+            if(size(intersection(g->adjacencyList[v], core)) < 2) {
+                removeElement(core, v);
+                removedVertex = true;
+            }
+        }
+    }
+    return size(core);
+}
+
+//  The dynamic program over a tree decomposition is only used for graphs with
+//  at least this many vertices. On smaller graphs the backtracking search is
+//  faster whatever the width, e.g. on random graphs with 10 to 13 vertices
+//  the dynamic program is hundreds of times slower.
+#define TD_MIN_ORDER 40
+
+int getCircumference(struct graph *g, struct options *options, bitset
+excludedVertices, struct witnessCache *cache) {
+
+    // A cycle of a recent graph which is still a cycle gives a lower bound.
+    int lowerBound = 0;
+    int upperBound = g->nv;
+    if(isEmpty(excludedVertices)) {
+        lowerBound = getWitnessLowerBound(g, cache, true);
+        upperBound = getCircumferenceUpperBound(g);
+        if(lowerBound == upperBound) {
+            return lowerBound;
+        }
+
+        // The cycles of a cactus are its blocks which are not an edge.
+        bitset cycleLengths;
+        if(isCactus(g->adjacencyList, g->nv, &cycleLengths)) {
+            int longestCycle = 0;
+            forEach(length, cycleLengths) {
+                longestCycle = length;
+            }
+            return longestCycle;
+        }
+    }
+
+    // For graphs of small treewidth the dynamic program over a tree
+    // decomposition is exponential in the width instead of in the order.
+    if(isEmpty(excludedVertices) && options->treeWidthThreshold >= 0 &&
+     g->nv >= TD_MIN_ORDER) {
+        int eliminationOrdering[g->nv];
+        int width = computeEliminationOrdering(g->adjacencyList, g->nv,
+         options->treeWidthThreshold, eliminationOrdering);
+        if(width <= options->treeWidthThreshold) {
+            if(options->hamiltonianCheck &&
+             getCircumferenceByTreeDecomposition(g->adjacencyList, g->nv,
+             eliminationOrdering, true)) {
+                return g->nv;
+            }
+            return getCircumferenceByTreeDecomposition(g->adjacencyList,
+             g->nv, eliminationOrdering, false);
+        }
+    }
 
     if(options->hamiltonianCheck) {
         if(isHamiltonian(g->adjacencyList, g->nv, EMPTY, false, false)) {
@@ -165,8 +434,28 @@ int getCircumference(struct graph *g, struct options *options, bitset excludedVe
         }
     }
 
-    // Check backwards from k = n to 3 if there is a cycle of length k.
-    for(int i = g->nv; i > 2; i--) {
+    // With -S only one vertex of each orbit of the automorphism group is used
+    // as a start vertex. Since we always forbid whole orbits, the forbidden
+    // vertices are preserved by all automorphisms. Of the two neighbours of
+    // the start vertex on the cycle, one can be taken to be the smallest
+    // vertex of its orbit under the stabiliser of the start vertex.
+    int orbits[g->nv];
+    int vertexColors[g->nv];
+    bool hasStabiliserOrbits[g->nv];
+    int (*stabiliserOrbits)[g->nv] = NULL;
+    if(options->symmetryFlag) {
+        stabiliserOrbits = malloc(g->nv * sizeof(*stabiliserOrbits));
+        for(int u = 0; u < g->nv; u++) {
+            vertexColors[u] = contains(excludedVertices, u) ? 1 : 0;
+            hasStabiliserOrbits[u] = false;
+        }
+        computeOrbits(g->adjacencyList, g->nv, vertexColors, orbits);
+    }
+
+    // Check backwards from k = n to 3 if there is a cycle of length k. Only
+    // cycles longer than the lower bound need to be checked.
+    int cycle[g->nv];
+    for(int i = upperBound; i > 2 && i > lowerBound; i--) {
 
         bitset forbiddenVertices = excludedVertices;
 
@@ -177,35 +466,71 @@ int getCircumference(struct graph *g, struct options *options, bitset excludedVe
             bitset includedVertices = 
              complement(forbiddenVertices, g->nv);
 
-            if(isEmpty(includedVertices)) return false;
+            // Forbidding whole orbits can leave too few vertices before
+            // all start vertices were tried, the next i may still fit.
+            if(size(includedVertices) < i - size(excludedVertices)) break;
 
             int v = findLowestDegreeVertex(g, includedVertices); 
+            bitset neighbours = 
+             intersection(g->adjacencyList[v], includedVertices);
+
+            // Neighbours which can be the first neighbour w of the start and
+            // neighbours which can be the second neighbour u if u < w.
+            bitset firstNeighbours = neighbours;
+            bitset smallerSecondNeighbours = EMPTY;
+            if(options->symmetryFlag) {
+                if(!hasStabiliserOrbits[v]) {
+                    vertexColors[v] = 2;
+                    computeOrbits(g->adjacencyList, g->nv, vertexColors,
+                     stabiliserOrbits[v]);
+                    vertexColors[v] = 0;
+                    hasStabiliserOrbits[v] = true;
+                }
+                firstNeighbours = EMPTY;
+                forEach(w, neighbours) {
+                    if(stabiliserOrbits[v][w] == w) add(firstNeighbours, w);
+                }
+                smallerSecondNeighbours = difference(neighbours,
+                 firstNeighbours);
+            }
 
             // Loop over included neighbours of start and for each such
             // neighbour loop over the included neighbours of start that are of
             // higher index. 
-            forEach(w, intersection(g->adjacencyList[v], includedVertices)) {
-                forEachAfterIndex(u, 
-                 intersection(g->adjacencyList[v], includedVertices), w) {
+            forEach(w, firstNeighbours) {
+                forEachAfterIndex(u, neighbours, w) {
 
                     // Create path uvw. We have u > w, so that we eliminate the
                     // checking of paths which are mirrored.
-                    bitset path = singleton(v);
-                    add(path, u);
-                    add(path, w);
-                    bitset remainingVertices = 
-                     difference(includedVertices, path);
-
-                    if (canBeCycleOfLength(g, remainingVertices, u, w,
-                     i - size(excludedVertices), 3)) {
+                    if(canBeCycleThroughPath(g, includedVertices, cycle, u,
+                     v, w, i - size(excludedVertices))) {
+                        addWitness(cache, cycle, i);
+                        free(stabiliserOrbits);
+                        return i;
+                    }
+                }
+                forEach(u, smallerSecondNeighbours) {
+                    if(u > w) break;
+                    if(canBeCycleThroughPath(g, includedVertices, cycle, u,
+                     v, w, i - size(excludedVertices))) {
+                        addWitness(cache, cycle, i);
+                        free(stabiliserOrbits);
                         return i;
                     }
                 }
             }
-            add(forbiddenVertices, v);
+            if(options->symmetryFlag) {
+                forEach(u, includedVertices) {
+                    if(orbits[u] == orbits[v]) add(forbiddenVertices, u);
+                }
+            }
+            else {
+                add(forbiddenVertices, v);
+            }
         }
     }
-    return 0;
+    free(stabiliserOrbits);
+    return lowerBound;
 }
 
 
@@ -215,51 +540,134 @@ int getCircumference(struct graph *g, struct options *options, bitset excludedVe
 //
 //******************************************************************************
 
-// // Method 1: join K1 with graph and compute its circumference.
+// Method 1: join K1 with graph and compute its circumference. Used when the
+// graph has small treewidth, since joining K1 increases the width by one.
 
-// // Free gNew->adjacencyList after!
-// void joinWithK1(struct graph *g, struct graph *gNew) {
-//     gNew->nv = g->nv + 1;
-//     gNew->adjacencyList = malloc(gNew->nv * sizeof(bitset)); 
+// Free gNew->adjacencyList after!
+void joinWithK1(struct graph *g, struct graph *gNew) {
+    gNew->nv = g->nv + 1;
+    gNew->adjacencyList = malloc(gNew->nv * sizeof(bitset)); 
 
-//     for(int i = 0; i < g->nv; i++) {
-//         gNew->adjacencyList[i] = union(g->adjacencyList[i], singleton(g->nv));
-//     }
-//     gNew->adjacencyList[g->nv] = complement(EMPTY, g->nv);
-// }
+    for(int i = 0; i < g->nv; i++) {
+        gNew->adjacencyList[i] = union(g->adjacencyList[i], singleton(g->nv));
+    }
+    gNew->adjacencyList[g->nv] = complement(EMPTY, g->nv);
+}
 
-// int getLength(struct graph *g) {
-//     struct graph g2;
-//     joinWithK1(g, &g2); 
+int getLengthByTreeDecomposition(struct graph *g, int eliminationOrdering[]) {
+    struct graph g2;
+    joinWithK1(g, &g2); 
 
-//     int length = getCircumference(&g2, EMPTY) - 2;
-//     if(length < 0) length = 0;
+    // Eliminating the new vertex last adds it to every bag.
+    int eliminationOrderingOfJoin[g2.nv];
+    for(int i = 0; i < g->nv; i++) {
+        eliminationOrderingOfJoin[i] = eliminationOrdering[i];
+    }
+    eliminationOrderingOfJoin[g->nv] = g->nv;
 
-//     free(g2.adjacencyList);
-//     return length;
-// }
+    int length = getCircumferenceByTreeDecomposition(g2.adjacencyList, g2.nv,
+     eliminationOrderingOfJoin, false) - 2;
+    if(length < 0) length = 0;
+
+    free(g2.adjacencyList);
+    return length;
+}
 
 // Method 2: directly search for a longest path. 
 
+// Returns the vertices of allowedVertices which can be reached from a vertex
+// of startVertices by a path through allowedVertices, including the vertices
+// of startVertices.
+bitset getReachableVertices(struct graph *g, bitset startVertices, bitset
+allowedVertices) {
+    bitset reachableVertices = startVertices;
+    bitset frontier = startVertices;
+    while(!isEmpty(frontier)) {
+        bitset neighbours = EMPTY;
+        forEach(v, frontier) {
+            neighbours = union(neighbours, g->adjacencyList[v]);
+        }
+        frontier = difference(intersection(neighbours, allowedVertices),
+         reachableVertices);
+        reachableVertices = union(reachableVertices, frontier);
+    }
+    return reachableVertices;
+}
+
+// Returns the order of a largest component, which is an upper bound for the
+// order of a path.
+int getOrderOfLargestComponent(struct graph *g) {
+    int largestOrder = 0;
+    bitset unvisitedVertices = complement(EMPTY, g->nv);
+    while(!isEmpty(unvisitedVertices)) {
+        bitset component = getReachableVertices(g,
+         singleton(next(unvisitedVertices, -1)), unvisitedVertices);
+        if(size(component) > largestOrder) largestOrder = size(component);
+        unvisitedVertices = difference(unvisitedVertices, component);
+    }
+    return largestOrder;
+}
+
 // Paths have an active end to which gets built, hence starting with uv will not
-// yield the same paths as starting with vu
+// yield the same paths as starting with vu. Each path is only counted from its
+// end with the lowest label. The low degree vertices are the remaining vertices
+// with less than two neighbours which are remaining vertices or the last
+// element, it may also contain vertices of the path.
 void searchLongestSuperPath(struct graph *g, bitset remainingVertices,
- int lastElemOfPath, int firstElemOfPath, int *orderOfLongestPath,
- int orderOfPath) {
+ bitset lowDegreeVertices, int pathList[], int longestPath[], int
+ lastElemOfPath, int firstElemOfPath, int *orderOfLongestPath, int
+ orderOfPath, int upperBound) {
 
     //  If found path of largest possible length, we are done.
-    if(*orderOfLongestPath == g->nv) {
+    if(*orderOfLongestPath >= upperBound) {
         return;
     }
 
-    // Check whether we current path is longest.
-    if(orderOfPath > *orderOfLongestPath) {
+    // Check whether we current path is longest. Every path is only counted
+    // when it ends in a vertex with a higher label than its first vertex.
+    pathList[orderOfPath - 1] = lastElemOfPath;
+    if(orderOfPath > *orderOfLongestPath && lastElemOfPath > firstElemOfPath) {
         *orderOfLongestPath = orderOfPath;
+        for(int i = 0; i < orderOfPath; i++) {
+            longestPath[i] = pathList[i];
+        }
     }
     
     bitset neighboursOfLastNotInPath = 
      intersection(g->adjacencyList[lastElemOfPath], remainingVertices);
 
+    // The path can only be extended by vertices which are reachable from its
+    // last element without passing through the path.
+    // Only one of these vertices can be the end of the path, the others need
+    // two neighbours on it. Hence at most one low degree vertex can be added.
+    bitset verticesAfterLast = difference(remainingVertices,
+     singleton(lastElemOfPath));
+    bitset reachableVertices = getReachableVertices(g,
+     neighboursOfLastNotInPath, verticesAfterLast);
+    int orderOfExtension = size(reachableVertices);
+    bitset reachableLowDegreeVertices = intersection(reachableVertices,
+     lowDegreeVertices);
+    if(!isEmpty(reachableLowDegreeVertices)) {
+        orderOfExtension -= size(reachableLowDegreeVertices) - 1;
+    }
+    if(orderOfPath + orderOfExtension <= *orderOfLongestPath) {
+        return;
+    }
+
+    // If no extension can end in a vertex with a higher label than the first
+    // vertex, all of them are counted when starting from their other end.
+    if(lastElemOfPath < firstElemOfPath &&
+     next(reachableVertices, firstElemOfPath) == -1) {
+        return;
+    }
+
+    // In every extension the last element leaves the remaining vertices, so
+    // only the degrees of its neighbours decrease.
+    lowDegreeVertices = union(lowDegreeVertices,
+     getVerticesWithLowDegreeIn(g->adjacencyList,
+     intersection(g->adjacencyList[lastElemOfPath], verticesAfterLast),
+     verticesAfterLast));
+
     forEach(neighbour, neighboursOfLastNotInPath) {
 
         int oldElemOfPath = lastElemOfPath;
@@ -269,17 +677,40 @@ void searchLongestSuperPath(struct graph *g, bitset remainingVertices,
         // Neighbour is the new last element.
         lastElemOfPath = neighbour; 
 
-        searchLongestSuperPath(g, remainingVertices, lastElemOfPath,
-         firstElemOfPath, orderOfLongestPath, orderOfPath + 1);
+        searchLongestSuperPath(g, remainingVertices, lowDegreeVertices,
+         pathList, longestPath, lastElemOfPath, firstElemOfPath,
+         orderOfLongestPath, orderOfPath + 1, upperBound);
 
         add(remainingVertices, oldElemOfPath);
         lastElemOfPath = oldElemOfPath;
     }
 }
 
-int getLength(struct graph *g, struct options* options) {
+int getLength(struct graph *g, struct options* options, struct witnessCache
+*cache) {
+
+    // A path of a recent graph which is still a path gives a lower bound.
+    int orderOfLongestPath = getWitnessLowerBound(g, cache, false);
+    int upperBound = getOrderOfLargestComponent(g);
+    if(orderOfLongestPath == upperBound) {
+        return orderOfLongestPath > 0 ? orderOfLongestPath - 1 : 0;
+    }
+
+    // In a forest the longest path is found by breadth-first searches.
+    bitset cycleLengths;
+    if(isCactus(g->adjacencyList, g->nv, &cycleLengths) &&
+     isEmpty(cycleLengths)) {
+        return getForestDiameter(g->adjacencyList, g->nv);
+    }
 
-    int orderOfLongestPath = 0;
+    if(options->treeWidthThreshold >= 1 && g->nv >= TD_MIN_ORDER) {
+        int eliminationOrdering[g->nv];
+        int width = computeEliminationOrdering(g->adjacencyList, g->nv,
+         options->treeWidthThreshold - 1, eliminationOrdering);
+        if(width <= options->treeWidthThreshold - 1) {
+            return getLengthByTreeDecomposition(g, eliminationOrdering);
+        }
+    }
 
     if(options->hamiltonianCheck) {
         if(isTraceable(g->adjacencyList, g->nv, EMPTY, false, false)) {
@@ -287,22 +718,34 @@ int getLength(struct graph *g, struct options* options) {
         }
     }
 
-    // For each vertex find a longest path starting with v.
+    // For each vertex find a longest path starting with v. Only paths longer
+    // than the lower bound are stored.
+    int lowerBound = orderOfLongestPath;
+    int pathList[g->nv];
+    int longestPath[g->nv];
     for(int v = 0; v < g->nv; v++) {
 
         bitset remainingVertices = complement(singleton(v), g->nv);
+        pathList[0] = v;
 
         // The number of vertices gets stored in orderOfLongestPath
         forEach(w, g->adjacencyList[v]) {
 
             removeElement(remainingVertices, w);
+            bitset lowDegreeVertices = difference(remainingVertices,
+             getVerticesWithTwoNeighboursIn(g->adjacencyList,
+             union(remainingVertices, singleton(w))));
 
-            searchLongestSuperPath(g, remainingVertices, w, v,
-             &orderOfLongestPath, 2);
+            searchLongestSuperPath(g, remainingVertices, lowDegreeVertices,
+             pathList, longestPath, w, v, &orderOfLongestPath, 2,
+             upperBound);
 
             add(remainingVertices, w);
         }
     }
+    if(orderOfLongestPath > lowerBound) {
+        addWitness(cache, longestPath, orderOfLongestPath);
+    }
 
     //  Length of a path is number of edges in it.
     int pathLength = orderOfLongestPath - 1;
@@ -313,160 +756,294 @@ int getLength(struct graph *g, struct options* options) {
 
 //******************************************************************************
 //
-//                      Longest induced cycle
+//                      Induced path and cycle searches
 //
 //******************************************************************************
 
-void lengthOfLongestInducedSuperCycle(struct graph *g, bitset remainingVertices,
- int lastElemOfPath, int firstElemOfPath, int *longestCycleLength,
- unsigned long long int numberOfLengths[], int pathLength) {
-
-    // Check whether we have a longest induced path already and whether this
-    // path is a cycle.
-    if(contains(g->adjacencyList[firstElemOfPath], lastElemOfPath)) {
-        if(pathLength > *longestCycleLength) {
-            *longestCycleLength = pathLength;
-        }
-
-        // Counter number of lengths of induced cycles. Used for keeping track
-        // of graphs with forbidden lengths of induced cycles.
-        numberOfLengths[pathLength]++;
-
-        //  Need to return because we already have a cycle. 
-        return;
-    }
-
-    // Check if cycle can still be closed with remaining vertices.
-    if(isEmpty(intersection(g->adjacencyList[firstElemOfPath], 
-     remainingVertices))) { 
-        return;
-    }
-
-    bitset neighboursOfLastNotInPath = 
-     intersection(g->adjacencyList[lastElemOfPath], remainingVertices);
-
-    forEach(neighbour, neighboursOfLastNotInPath) {
+//  The searches for induced paths and cycles come in several variants. Each one
+//  is generated from the same template, so that it only does the bookkeeping
+//  it needs and the compiler removes everything else, in the same way the
+//  bitset width is chosen at compile time.
+//
+//  COUNT_LENGTHS   counts how many induced paths or cycles of each length are
+//                  found in numberOfLengths and keeps track of the longest one.
+//  LONGEST_LENGTH  only computes the longest length and cuts paths which cannot
+//                  become longer than the longest one found so far. The search
+//                  stops once the longest length reaches bound.
+//  TARGET_LENGTH   only for cycles, stops as soon as one of length bound is
+//                  found and never extends paths beyond that length. Paths
+//                  need no such variant, since an induced path contains
+//                  induced paths of all smaller lengths.
+//  ODD_HOLE        only for cycles, stops as soon as an induced cycle of odd
+//                  length at least 5 is found.
+#define COUNT_LENGTHS 0
+#define LONGEST_LENGTH 1
+#define TARGET_LENGTH 2
+#define ODD_HOLE 3
+
+//  The neighbourhood of v in the graph or in its complement. The complement is
+//  never stored, its neighbourhoods are computed when they are needed.
+#define NEIGHBOURS(g, v) ((g)->adjacencyList[v])
+#define COMPLEMENT_NEIGHBOURS(g, v)                                            \
+ difference(complement((g)->adjacencyList[v], (g)->nv), singleton(v))
+
+//  For paths, the lengths in longest and bound are numbers of vertices.
+struct inducedSearch {
+    unsigned long long int *numberOfLengths;
+    int longest;
+    int bound;
+};
 
-        int oldElemOfPath = lastElemOfPath;
+//  Defines a function extending the induced path ending in lastElemOfPath with
+//  vertices of remainingVertices, i.e. vertices which are not in the path and
+//  not adjacent to any of its elements apart from the last one. The path is
+//  searched in the graph given by neighbours, which is NEIGHBOURS or
+//  COMPLEMENT_NEIGHBOURS. Returns true if the search can stop.
+#define DEFINE_INDUCED_PATH_SEARCH(name, variant, neighbours)                  \
+bool name(struct graph *g, bitset remainingVertices, int lastElemOfPath,       \
+ int orderOfPath, struct inducedSearch *search) {                              \
+                                                                               \
+    if(variant == COUNT_LENGTHS) {                                             \
+        search->numberOfLengths[orderOfPath - 1]++;                            \
+    }                                                                          \
+    if(orderOfPath > search->longest) {                                        \
+        search->longest = orderOfPath;                                         \
+    }                                                                          \
+    if(variant == LONGEST_LENGTH && search->longest >= search->bound) {        \
+        return true;                                                           \
+    }                                                                          \
+                                                                               \
+    /* After the next vertex, the path can only be extended with remaining */  \
+    /* vertices which are not adjacent to the current last element. */         \
+    bitset neighboursOfLast = neighbours(g, lastElemOfPath);                   \
+    bitset remainingAfterLast = difference(remainingVertices,                  \
+     neighboursOfLast);                                                        \
+    if(variant == LONGEST_LENGTH && orderOfPath + 1 +                          \
+     size(remainingAfterLast) <= search->longest) {                            \
+        return false;                                                          \
+    }                                                                          \
+                                                                               \
+    bitset neighboursOfLastNotInPath =                                         \
+     intersection(neighboursOfLast, remainingVertices);                        \
+    forEach(neighbour, neighboursOfLastNotInPath) {                            \
+        if(name(g, remainingAfterLast, neighbour, orderOfPath + 1, search)) {  \
+            return true;                                                       \
+        }                                                                      \
+    }                                                                          \
+    return false;                                                              \
+}
 
-        //  Delete neighbours of oldElemOfPath since no chord are allowed in the
-        //  induced cycle.
-        remainingVertices = difference(remainingVertices,
-         g->adjacencyList[oldElemOfPath]);
+//  Same as DEFINE_INDUCED_PATH_SEARCH, but the path should become an induced
+//  cycle through firstElemOfPath. The length of a cycle is its number of
+//  vertices.
+#define DEFINE_INDUCED_CYCLE_SEARCH(name, variant, neighbours)                 \
+bool name(struct graph *g, bitset remainingVertices, int lastElemOfPath,       \
+ int firstElemOfPath, int pathLength, struct inducedSearch *search) {          \
+                                                                               \
+    bitset neighboursOfFirst = neighbours(g, firstElemOfPath);                 \
+    bitset neighboursOfLast = neighbours(g, lastElemOfPath);                   \
+                                                                               \
+    /* A chord to the first element closes the cycle, so it cannot be */       \
+    /* extended any further. */                                                \
+    if(contains(neighboursOfFirst, lastElemOfPath)) {                          \
+        if(variant == ODD_HOLE) {                                              \
+            return pathLength >= 5 && pathLength % 2 == 1;                     \
+        }                                                                      \
+        if(variant == COUNT_LENGTHS) {                                         \
+            search->numberOfLengths[pathLength]++;                             \
+        }                                                                      \
+        if(variant == TARGET_LENGTH) {                                         \
+            return pathLength == search->bound;                                \
+        }                                                                      \
+        if(pathLength > search->longest) {                                     \
+            search->longest = pathLength;                                      \
+        }                                                                      \
+        return variant == LONGEST_LENGTH && search->longest >= search->bound;  \
+    }                                                                          \
+    if(variant == TARGET_LENGTH && pathLength >= search->bound) {              \
+        return false;                                                          \
+    }                                                                          \
+                                                                               \
+    /* Check if cycle can still be closed with remaining vertices. */          \
+    if(isEmpty(intersection(neighboursOfFirst, remainingVertices))) {          \
+        return false;                                                          \
+    }                                                                          \
+                                                                               \
+    bitset remainingAfterLast = difference(remainingVertices,                  \
+     neighboursOfLast);                                                        \
+    if(variant == LONGEST_LENGTH && pathLength + 1 +                           \
+     size(remainingAfterLast) <= search->longest) {                            \
+        return false;                                                          \
+    }                                                                          \
+    if(variant == TARGET_LENGTH && pathLength + 1 +                            \
+     size(remainingAfterLast) < search->bound) {                               \
+        return false;                                                          \
+    }                                                                          \
+                                                                               \
+    bitset neighboursOfLastNotInPath =                                         \
+     intersection(neighboursOfLast, remainingVertices);                        \
+    forEach(neighbour, neighboursOfLastNotInPath) {                            \
+        if(name(g, remainingAfterLast, neighbour, firstElemOfPath,             \
+         pathLength + 1, search)) {                                            \
+            return true;                                                       \
+        }                                                                      \
+    }                                                                          \
+    return false;                                                              \
+}
 
-        bitset deletedVertices = difference(g->adjacencyList[oldElemOfPath],
-         remainingVertices);
+DEFINE_INDUCED_PATH_SEARCH(countInducedPaths, COUNT_LENGTHS, NEIGHBOURS)
+DEFINE_INDUCED_PATH_SEARCH(searchLongestInducedPath, LONGEST_LENGTH,
+ NEIGHBOURS)
+
+DEFINE_INDUCED_CYCLE_SEARCH(countInducedCycles, COUNT_LENGTHS, NEIGHBOURS)
+DEFINE_INDUCED_CYCLE_SEARCH(searchLongestInducedCycle, LONGEST_LENGTH,
+ NEIGHBOURS)
+DEFINE_INDUCED_CYCLE_SEARCH(searchInducedCycleOfLength, TARGET_LENGTH,
+ NEIGHBOURS)
+DEFINE_INDUCED_CYCLE_SEARCH(searchOddHole, ODD_HOLE, NEIGHBOURS)
+
+// The same searches in the complement of the graph.
+DEFINE_INDUCED_PATH_SEARCH(countInducedPathsInComplement, COUNT_LENGTHS,
+ COMPLEMENT_NEIGHBOURS)
+DEFINE_INDUCED_PATH_SEARCH(searchLongestInducedPathInComplement,
+ LONGEST_LENGTH, COMPLEMENT_NEIGHBOURS)
+
+DEFINE_INDUCED_CYCLE_SEARCH(countInducedCyclesInComplement, COUNT_LENGTHS,
+ COMPLEMENT_NEIGHBOURS)
+DEFINE_INDUCED_CYCLE_SEARCH(searchLongestInducedCycleInComplement,
+ LONGEST_LENGTH, COMPLEMENT_NEIGHBOURS)
+DEFINE_INDUCED_CYCLE_SEARCH(searchInducedCycleOfLengthInComplement,
+ TARGET_LENGTH, COMPLEMENT_NEIGHBOURS)
+DEFINE_INDUCED_CYCLE_SEARCH(searchOddAntihole, ODD_HOLE, COMPLEMENT_NEIGHBOURS)
+
+typedef bool (*inducedPathSearch)(struct graph *, bitset, int, int,
+ struct inducedSearch *);
+typedef bool (*inducedCycleSearch)(struct graph *, bitset, int, int, int,
+ struct inducedSearch *);
+
+// Starts searchFunction from every edge vw. If complementView is true, the
+// paths are searched in the complement of the graph, which should then also be
+// the view of searchFunction. Returns true if the search was stopped early.
+bool searchInducedPaths(struct graph *g, inducedPathSearch searchFunction,
+ struct inducedSearch *search, bool complementView) {
 
-        lastElemOfPath = neighbour;
+    for(int v = 0; v < g->nv; v++) {
 
-        lengthOfLongestInducedSuperCycle(g, remainingVertices, lastElemOfPath,
-         firstElemOfPath, longestCycleLength, numberOfLengths, pathLength + 1);
+        bitset neighboursOfV = complementView ?
+         COMPLEMENT_NEIGHBOURS(g, v) : NEIGHBOURS(g, v);
+        bitset remainingVertices = complement(neighboursOfV, g->nv);
+        removeElement(remainingVertices, v);
 
-        //  Once oldElemOfPath is again an end of the path, the neighbours we
-        //  removed should be considered again.
-        remainingVertices = union(remainingVertices, deletedVertices);
-        lastElemOfPath = oldElemOfPath;
+        forEach(w, neighboursOfV) {
+            if(searchFunction(g, remainingVertices, w, 2, search)) {
+                return true;
+            }
+        }
     }
+    return false;
 }
 
-int getLongestInducedCycleLength(struct graph *g, 
- unsigned long long int numberOfLengths[]) {
+// Starts searchFunction from every induced path uvw in which v is the vertex
+// with the lowest label. Vertices with a lower label than v are no longer
+// included, so that each induced cycle is found once. If complementView is
+// true, the cycles are searched in the complement of the graph, which should
+// then also be the view of searchFunction. Returns true if the search was
+// stopped early.
+bool searchInducedCycles(struct graph *g, inducedCycleSearch searchFunction,
+ struct inducedSearch *search, bool complementView) {
 
-    int longestInducedCycleLength = 0;
+    // The graph without vertices has no cycles.
+    if(g->nv == 0) return false;
 
-    // Loop over all vertices v and find the longed induced cycle going through
-    // it.
+    bitset includedVertices = complement(EMPTY, g->nv);
     for(int v = 0; v < g->nv; v++) {
 
-        bitset includedVertices = complement(EMPTY, g->nv);
-
         // Loop over included neighbours w of v and for each w loop over the
         // included neighbours u of v that are of higher index than w.
-        forEachAfterIndex(w, intersection(g->adjacencyList[v], includedVertices),
-         v) {
-            forEachAfterIndex(u, 
-             intersection(g->adjacencyList[v], includedVertices), w) {
+        bitset neighboursOfV = complementView ?
+         COMPLEMENT_NEIGHBOURS(g, v) : NEIGHBOURS(g, v);
+        bitset neighbours = intersection(neighboursOfV, includedVertices);
+        forEachAfterIndex(w, neighbours, v) {
+            forEachAfterIndex(u, neighbours, w) {
 
                 bitset remainingVertices = difference(includedVertices,
-                 union(g->adjacencyList[v], singleton(v)));
+                 union(neighboursOfV, singleton(v)));
 
-                // Stores length of longest induced cycle containing uvw in
-                // longestInducedCycleLength if it is the largest length
-                // encountered.
-                lengthOfLongestInducedSuperCycle(g, remainingVertices, u, w,
-                 &longestInducedCycleLength, numberOfLengths, 3);
+                if(searchFunction(g, remainingVertices, u, w, 3, search)) {
+                    return true;
+                }
             }
         }
+        removeElement(includedVertices, v);
     }
-
-    return longestInducedCycleLength;
+    return false;
 }
 
+// The searchFunction should be countInducedCycles, in which case
+// numberOfLengths gets filled in, or searchLongestInducedCycle, or their
+// versions for the complement if complementView is true.
+int getLongestInducedCycleLength(struct graph *g,
+ inducedCycleSearch searchFunction, unsigned long long int numberOfLengths[],
+ bool complementView) {
 
-//******************************************************************************
-//
-//                          Longest induced path
-//
-//******************************************************************************
-
-void searchLongestInducedSuperPath(struct graph *g, bitset remainingVertices,
- int lastElemOfPath, int firstElemOfPath, int *orderOfLongestInducedPath,
- unsigned long long int numberOfLengths[], int orderOfPath) {
-
-    // Count frequency of induced paths. Length of a path is number of edges,
-    // not vertices. Used for keeping track of graphs with forbidden induced
-    // path sizes.
-    numberOfLengths[orderOfPath - 1]++;
+    // The 2-core is not computed for the complement, which is usually
+    // connected and dense anyway.
+    struct inducedSearch search = {numberOfLengths, 0,
+     complementView ? g->nv : getCircumferenceUpperBound(g)};
 
-    // Check whether we have a longest induced path already.
-    if(orderOfPath > *orderOfLongestInducedPath) {
-        *orderOfLongestInducedPath = orderOfPath;
-    }
-    
-    bitset neighboursOfLastNotInPath = 
-     intersection(g->adjacencyList[lastElemOfPath], remainingVertices);
+    // Without a 2-core there are no cycles at all.
+    if(search.bound < 3) return 0;
+    searchInducedCycles(g, searchFunction, &search, complementView);
 
-    forEach(neighbour, neighboursOfLastNotInPath) {
+    return search.longest;
+}
 
-        int oldElemOfPath = lastElemOfPath;
+// Returns whether the graph, or its complement if complementView is true,
+// contains an induced cycle of the given length. Used for -f#, where the
+// search can stop at the first such cycle.
+bool containsInducedCycleOfLength(struct graph *g, int cycleLength,
+ bool complementView) {
 
-        remainingVertices = 
-         difference(remainingVertices, g->adjacencyList[oldElemOfPath]);
-        bitset deletedVertices = 
-         difference(g->adjacencyList[oldElemOfPath], remainingVertices);
+    if(cycleLength < 3 || cycleLength > g->nv) return false;
 
-        // Neighbour is the new last element.
-        lastElemOfPath = neighbour; 
+    struct inducedSearch search = {NULL, 0, cycleLength};
+    return searchInducedCycles(g, complementView ?
+     searchInducedCycleOfLengthInComplement : searchInducedCycleOfLength,
+     &search, complementView);
+}
 
-        searchLongestInducedSuperPath(g, remainingVertices, lastElemOfPath,
-         firstElemOfPath, orderOfLongestInducedPath, numberOfLengths,
-         orderOfPath + 1);
+// Returns whether the graph is Berge, i.e. contains no odd hole and no odd
+// antihole of length at least 5. The odd antiholes are the odd holes of the
+// complement, which is searched without storing it. The search stops at the
+// first odd hole or antihole.
+bool isBerge(struct graph *g) {
 
-        remainingVertices = union(remainingVertices, deletedVertices);
-        lastElemOfPath = oldElemOfPath;
+    struct inducedSearch search = {NULL, 0, 0};
+    if(searchInducedCycles(g, searchOddHole, &search, false)) {
+        return false;
     }
+    return !searchInducedCycles(g, searchOddAntihole, &search, true);
 }
 
-int getLongestInducedPathLength(struct graph *g, 
- unsigned long long int numberOfLengths[]) {
-
-    int orderOfLongestInducedPath = 0;
-
-    // For each vertex find a longest induced path starting with v.
-    for(int v = 0; v < g->nv; v++) {
-
-        bitset remainingVertices = complement(g->adjacencyList[v], g->nv);
-        removeElement(remainingVertices, v);
-
-        // The number of vertices gets stored inorderOfLongestInducedPath 
-        forEach(w, g->adjacencyList[v]) {
-            searchLongestInducedSuperPath(g, remainingVertices, w, v,
-             &orderOfLongestInducedPath, numberOfLengths, 2);
-        }
+// The searchFunction should be countInducedPaths, in which case
+// numberOfLengths gets filled in, or searchLongestInducedPath, or their
+// versions for the complement if complementView is true.
+int getLongestInducedPathLength(struct graph *g,
+ inducedPathSearch searchFunction, unsigned long long int numberOfLengths[],
+ bool complementView) {
+
+    // Every shortest path is induced, so the search starts from the length of
+    // a shortest path between two far apart vertices and stops as soon as it
+    // meets the upper bound.
+    struct inducedSearch search = {numberOfLengths, 0, g->nv};
+    if(!complementView) {
+        search.longest = getForestDiameter(g->adjacencyList, g->nv) + 1;
+        search.bound = getOrderOfLargestComponent(g);
     }
+    searchInducedPaths(g, searchFunction, &search, complementView);
 
     //  Length of a path is number of edges in it.
-    int pathLength = orderOfLongestInducedPath - 1;
+    int pathLength = search.longest - 1;
     if(pathLength < 0) pathLength = 0;
 
     return pathLength;
@@ -547,6 +1124,34 @@ void printTable(struct options *options,
     fprintf(stderr, "\n");
 }
 
+// Writes the graph6 string on one line, followed by the lengths of the induced
+// cycles or paths present in the graph.
+void printSpectrum(char *graphString, unsigned long long int numberOfLengths[]) {
+    printf("%.*s", (int) strcspn(graphString, "\n"), graphString);
+    for(int i = 0; i < BITSETSIZE; i++) {
+        if(numberOfLengths[i] != 0) {
+            printf(" %d", i);
+        }
+    }
+    printf("\n");
+}
+
+// For each length, print how many graphs contain an induced cycle or path of
+// that length and how many do not, i.e. the graphs -f# would send to stdout.
+void printSpectrumTable(struct options *options,
+ unsigned long long int graphsWithLength[], unsigned long long int counter) {
+
+    fprintf(stderr, "\nInduced %s lengths:",
+     options->pathFlag ? "path" : "cycle");
+    for(int i = 0; i < BITSETSIZE; i++) {
+        if(graphsWithLength[i] != 0) {
+            fprintf(stderr, "\n \t%16lld graphs with, %16lld without length %d",
+             graphsWithLength[i], counter - graphsWithLength[i], i);
+        }
+    }
+    fprintf(stderr, "\n");
+}
+
 void printNumberGraphsOutput(struct options *options,
  long long unsigned int passedGraphs, char *tableString) {
 
@@ -571,11 +1176,328 @@ void printNumberGraphsOutput(struct options *options,
     }
 }
 
+#ifndef PROCESS_GRAPH
+#define PROCESS_GRAPH processGraph
+#endif
+#ifndef SELECT_INDUCED_SEARCHES
+#define SELECT_INDUCED_SEARCHES selectInducedSearches
+#endif
+
+//  The variants of the induced searches which are used for every graph.
+struct inducedSearches {
+    inducedCycleSearch cycleFunction;
+    inducedPathSearch pathFunction;
+};
+
+//  Chooses the variants of the induced searches once from the options. The
+//  table only needs the longest length, -f# looks for the forbidden length
+//  separately. For -s all lengths are counted in a single pass, which also
+//  answers -f#. With -G the versions searching the complement are used.
+//  Every version of PROCESS_GRAPH has its own searches, so this function is
+//  renamed along with it.
+const struct inducedSearches *SELECT_INDUCED_SEARCHES(
+ struct options *options) {
+    static const struct inducedSearches searches[2][2] = {
+        {{searchLongestInducedCycle, searchLongestInducedPath},
+         {countInducedCycles, countInducedPaths}},
+        {{searchLongestInducedCycleInComplement,
+          searchLongestInducedPathInComplement},
+         {countInducedCyclesInComplement, countInducedPathsInComplement}}
+    };
+    return &searches[options->complementGraphFlag][options->spectrumFlag];
+}
+
+//  Checks a single graph and adds the result to the statistics. The searches
+//  should be chosen by SELECT_INDUCED_SEARCHES of the same version.
+//  PROCESS_GRAPH renames this function when several versions of the program
+//  are linked into a single binary, see dispatchGraph.
+void PROCESS_GRAPH(char *graphString, struct options *options,
+ const struct inducedSearches *searches, struct statistics *statistics) {
+
+    int optionsNumber = (options->differenceFlag ? 1 : 0) |
+                        (options->forbiddenLength != -1 ? 2 : 0);
+
+    // Longest cycles or paths of the most recent graphs.
+    static struct witnessCache witnessCache;
+
+    struct graph g;
+    g.nv = getNumberOfVertices(graphString);
+    if(g.nv == -1 || g.nv > BITSETSIZE - 1) {
+        fprintf(stderr, "Skipping invalid graph!\n");
+        statistics->skippedGraphs++;
+        return;
+    }
+
+    // The length is computed as the circumference of the graph joined with a
+    // vertex, so there should be room for one more vertex.
+    resizeBitsets(g.nv + 1);
+
+    // The adjacency lists are allocated on the heap, for the large version
+    // they can be too big for the stack.
+    bitset *adjacencyList = malloc(sizeof(bitset) * g.nv);
+    if(loadGraph(graphString, g.nv, adjacencyList) == -1) {
+        fprintf(stderr, "Skipping invalid graph!\n");
+        statistics->skippedGraphs++;
+        free(adjacencyList);
+        return;
+    }
+    g.adjacencyList = adjacencyList;
+    statistics->counter++;
+
+    // With -G the induced searches look at the complement through the
+    // adjacency lists of the graph. The other computations hand the
+    // adjacency lists to other methods, so they get the complement.
+    bitset *complementAdjacencyList = NULL;
+    if(options->complementGraphFlag && !options->cycleFlag &&
+     !options->pathFlag) {
+        complementAdjacencyList = malloc(sizeof(bitset) * g.nv);
+        for(int v = 0; v < g.nv; v++) {
+            complementAdjacencyList[v] = COMPLEMENT_NEIGHBOURS(&g, v);
+        }
+        g.adjacencyList = complementAdjacencyList;
+    }
+
+    // Length is largest length of (induced) cycle(or path). numberOfLenghts
+    // keeps track of each length encountered for the induced paths or
+    // cycles. Used for not counting forbidden induced cycle or path
+    // lengths.
+    int length;
+    unsigned long long int numberOfLengths[BITSETSIZE] = 
+     { [ 0 ... BITSETSIZE-1 ] = 0 };
+
+    // Lengths of the cycles if the graph is a cactus.
+    bitset cycleLengths;
+
+    // For -f# we only need to know whether there is an induced cycle or
+    // path of the forbidden length, which is stored in numberOfLengths.
+    // Lengths which are too long are not looked up.
+    bool checkForbiddenLength = !options->spectrumFlag &&
+     options->forbiddenLength >= 0 && options->forbiddenLength < BITSETSIZE;
+    if(options->cycleFlag && !options->complementGraphFlag &&
+     isChordal(g.adjacencyList, g.nv)) {
+
+        // Chordal graphs have no induced cycles longer than 3 and contain
+        // a triangle if they are not acyclic. For -f# and -s only the
+        // presence of a length matters, not how often it occurs.
+        length = getCircumferenceUpperBound(&g) >= 3 ? 3 : 0;
+        numberOfLengths[3] = length == 3 ? 1 : 0;
+    }
+    else if(options->cycleFlag && !options->complementGraphFlag &&
+     isCactus(g.adjacencyList, g.nv, &cycleLengths)) {
+
+        // Every cycle of a cactus is induced.
+        length = 0;
+        forEach(cycleLength, cycleLengths) {
+            numberOfLengths[cycleLength] = 1;
+            length = cycleLength;
+        }
+    }
+    else if(options->cycleFlag) {
+        length = getLongestInducedCycleLength(&g, searches->cycleFunction,
+         numberOfLengths, options->complementGraphFlag);
+        if(checkForbiddenLength) {
+            numberOfLengths[options->forbiddenLength] =
+             containsInducedCycleOfLength(&g, options->forbiddenLength,
+             options->complementGraphFlag);
+        }
+    }
+    else if(options->pathFlag && !options->complementGraphFlag &&
+     isCograph(g.adjacencyList, g.nv)) {
+
+        // Cographs contain no induced path of length 3. They contain one
+        // of length 2 unless all components are complete. An induced path
+        // contains induced paths of all shorter lengths.
+        length = 0;
+        for(int v = 0; v < g.nv; v++) {
+            if(!isEmpty(g.adjacencyList[v])) length = 1;
+        }
+        if(length == 1 && !isDisjointUnionOfCliques(g.adjacencyList, g.nv)) {
+            length = 2;
+        }
+        for(int i = 1; i <= length; i++) {
+            numberOfLengths[i] = 1;
+        }
+    }
+    else if(options->pathFlag && !options->complementGraphFlag &&
+     isCactus(g.adjacencyList, g.nv, &cycleLengths) &&
+     isEmpty(cycleLengths)) {
+
+        // Every path of a forest is induced.
+        length = getForestDiameter(g.adjacencyList, g.nv);
+        for(int i = 1; i <= length; i++) {
+            numberOfLengths[i] = 1;
+        }
+    }
+    else if(options->pathFlag) {
+        length = getLongestInducedPathLength(&g, searches->pathFunction,
+         numberOfLengths, options->complementGraphFlag);
+
+        // A longest induced path contains induced paths of all smaller
+        // lengths.
+        if(checkForbiddenLength) {
+            numberOfLengths[options->forbiddenLength] =
+             options->forbiddenLength >= 1 &&
+             options->forbiddenLength <= length;
+        }
+    }
+    else if(options->bergeFlag) {
+        length = isBerge(&g);
+    }
+    else if(options->kHamiltonicity == 1) {
+        length = options->certificateFlag ?
+         isK1HamiltonianByCertificates(g.adjacencyList, g.nv) :
+         isK1Hamiltonian(g.adjacencyList, g.nv, false, false, -1);
+    }
+    else if(options->kHamiltonicity == 2) {
+        int vertexPairToCheck[2] = {-1, -1};
+        length = options->certificateFlag ?
+         isK2HamiltonianByCertificates(g.adjacencyList, g.nv) :
+         isK2Hamiltonian(g.adjacencyList, g.nv, false, false,
+         vertexPairToCheck);
+    }
+    else if(options->colorCodingLength != -1 && options->lengthFlag) {
+        length = containsPathOfLength(g.adjacencyList, g.nv,
+         options->colorCodingLength, options->colorCodingTrials,
+         &statistics->seed);
+    }
+    else if(options->colorCodingLength != -1) {
+        length = containsCycleOfLength(g.adjacencyList, g.nv,
+         options->colorCodingLength, options->colorCodingTrials,
+         &statistics->seed);
+    }
+    else if(options->lengthFlag) {
+        length = getLength(&g, options, &witnessCache);
+    }
+    else {
+        length = getCircumference(&g, options, EMPTY, &witnessCache);
+    }
+
+    if(options->spectrumFlag) {
+        for(int i = 0; i < BITSETSIZE; i++) {
+            if(numberOfLengths[i] != 0) statistics->graphsWithLength[i]++;
+        }
+
+        // Without -o# or -f# every graph is written with its spectrum.
+        if((options->output == -1 && options->forbiddenLength == -1) ||
+         shouldOutput(&g, length, numberOfLengths, optionsNumber,
+         options)) {
+            statistics->passedGraphs++;
+            printSpectrum(graphString, numberOfLengths);
+        }
+    }
+    else if(shouldOutput(&g, length, numberOfLengths,  optionsNumber,
+     options)) {
+        statistics->passedGraphs++;
+        printf("%s", graphString);
+    }
+    if(options->differenceFlag) {
+        statistics->frequencies[g.nv - length]++;
+    }
+    else {
+        statistics->frequencies[length]++;
+    }
+    free(adjacencyList);
+    free(complementAdjacencyList);
+}
+
+//  `make dispatch` also compiles this file for 64, 128, 192 and 256 bits with
+//  PROCESS_GRAPH set to processGraph64, ..., processGraph256, and links them
+//  into the large version with DISPATCH defined. Every graph is then checked
+//  by the smallest version which can hold it. SELECT_INDUCED_SEARCHES is
+//  renamed in the same way. This version only passes the searches of the
+//  other versions on, so it does not depend on their layout.
+#ifdef DISPATCH
+#define DECLARE_VERSION(width)                                                 \
+const struct inducedSearches *selectInducedSearches##width(                    \
+ struct options *options);                                                     \
+void processGraph##width(char *graphString, struct options *options,           \
+ const struct inducedSearches *searches, struct statistics *statistics);
+
+DECLARE_VERSION(64)
+DECLARE_VERSION(128)
+DECLARE_VERSION(192)
+DECLARE_VERSION(256)
+#endif
+
+//  The induced searches of every version, chosen once before reading graphs.
+struct searchesOfVersions {
+#ifdef DISPATCH
+    const struct inducedSearches *searches64;
+    const struct inducedSearches *searches128;
+    const struct inducedSearches *searches192;
+    const struct inducedSearches *searches256;
+#endif
+    const struct inducedSearches *searches;
+};
+
+void selectSearchesOfVersions(struct options *options,
+ struct searchesOfVersions *versions) {
+#ifdef DISPATCH
+    versions->searches64 = selectInducedSearches64(options);
+    versions->searches128 = selectInducedSearches128(options);
+    versions->searches192 = selectInducedSearches192(options);
+    versions->searches256 = selectInducedSearches256(options);
+#endif
+    versions->searches = SELECT_INDUCED_SEARCHES(options);
+}
+
+void dispatchGraph(char *graphString, struct options *options,
+ struct searchesOfVersions *versions, struct statistics *statistics) {
+#ifdef DISPATCH
+    int numberOfVertices = getNumberOfVertices(graphString);
+    if(numberOfVertices != -1 && numberOfVertices < 64) {
+        processGraph64(graphString, options, versions->searches64, statistics);
+        return;
+    }
+    if(numberOfVertices != -1 && numberOfVertices < 128) {
+        processGraph128(graphString, options, versions->searches128,
+         statistics);
+        return;
+    }
+    if(numberOfVertices != -1 && numberOfVertices < 192) {
+        processGraph192(graphString, options, versions->searches192,
+         statistics);
+        return;
+    }
+    if(numberOfVertices != -1 && numberOfVertices < 256) {
+        processGraph256(graphString, options, versions->searches256,
+         statistics);
+        return;
+    }
+#endif
+    PROCESS_GRAPH(graphString, options, versions->searches, statistics);
+}
+
+struct graphReader {
+    struct options *options;
+    struct searchesOfVersions *versions;
+    struct statistics *statistics;
+};
+
+//  Checks every graph on stdin. The argument is a struct graphReader, so
+//  that this can be run on a separate thread.
+void *checkGraphsFromStdin(void *argument) {
+    struct graphReader *reader = argument;
+
+    //  Start looping over lines of stdin.
+    char * graphString = NULL;
+    size_t size;
+    while(getline(&graphString, &size, stdin) != -1) {
+        dispatchGraph(graphString, reader->options, reader->versions,
+         reader->statistics);
+    }
+    free(graphString);
+    return NULL;
+}
+
 int main(int argc, char ** argv) {
 
     struct options options = {0};
     options.forbiddenLength = -1;
     options.output = -1;
+    options.treeWidthThreshold = 5;
+    options.colorCodingLength = -1;
+    options.colorCodingTrials = -1;
     char* tableString = "circumference";
 
     int opt;
@@ -591,10 +1513,22 @@ int main(int argc, char ** argv) {
             {"length", no_argument, NULL, 'l'},
             {"output", required_argument, NULL, 'o'},
             {"induced-path", no_argument, NULL, 'p'},
-            {"hamiltonian", no_argument, NULL, 'H'}
+            {"hamiltonian", no_argument, NULL, 'H'},
+            {"treewidth", required_argument, NULL, 't'},
+            {"color-coding", required_argument, NULL, 'k'},
+            {"trials", required_argument, NULL, 'T'},
+            {"deterministic", no_argument, NULL, 'D'},
+            {"symmetry", no_argument, NULL, 'S'},
+            {"spectrum", no_argument, NULL, 's'},
+            {"berge", no_argument, NULL, 'B'},
+            {"complement-graph", no_argument, NULL, 'G'},
+            {"k1-hamiltonian", no_argument, NULL, '1'},
+            {"k2-hamiltonian", no_argument, NULL, '2'},
+            {"certificates", no_argument, NULL, 'x'}
         };
 
-        opt = getopt_long(argc, argv, "cCdf:hlo:pH", long_options, &option_index);
+        opt = getopt_long(argc, argv, "cCdf:hlo:pHt:k:T:DSsBG12x",
+         long_options, &option_index);
         if (opt == -1) break;
         switch(opt) {
             case 'c':
@@ -628,6 +1562,53 @@ int main(int argc, char ** argv) {
             case 'H':
                 options.hamiltonianCheck = true;
                 break;
+            case 't':
+                options.treeWidthThreshold =
+                 (int) strtol(optarg, (char **)NULL, 10);
+                break;
+            case 'k':
+                options.colorCodingLength =
+                 (int) strtol(optarg, (char **)NULL, 10);
+                break;
+            case 'T': {
+                char *end;
+                options.colorCodingTrials = strtoll(optarg, &end, 10);
+                if(end == optarg || *end != '\0' ||
+                 options.colorCodingTrials < 1) {
+                    fprintf(stderr,
+                     "Error: -T# should be a positive number.\n");
+                    fprintf(stderr, "%s\n", USAGE);
+                    return 1;
+                }
+                break;
+            }
+            case 'D':
+                options.deterministicFlag = true;
+                break;
+            case 'S':
+                options.symmetryFlag = true;
+                break;
+            case 's':
+                options.spectrumFlag = true;
+                break;
+            case 'B':
+                options.bergeFlag = true;
+                tableString = "Berge";
+                break;
+            case 'G':
+                options.complementGraphFlag = true;
+                break;
+            case '1':
+                options.kHamiltonicity = 1;
+                tableString = "K1-hamiltonian";
+                break;
+            case '2':
+                options.kHamiltonicity = 2;
+                tableString = "K2-hamiltonian";
+                break;
+            case 'x':
+                options.certificateFlag = true;
+                break;
             case '?':
                 fprintf(stderr,"Error: Unknown option: %c\n", optopt);
                 fprintf(stderr, "%s\n", USAGE);
@@ -645,6 +1626,12 @@ int main(int argc, char ** argv) {
         return 1;       
     }
 
+    if(options.treeWidthThreshold > TD_MAX_WIDTH) {
+        fprintf(stderr, "Error: -t# should be at most %d.\n", TD_MAX_WIDTH);
+        fprintf(stderr, "%s\n", USAGE);
+        return 1;
+    }
+
     if(options.cycleFlag && options.pathFlag) {
         fprintf(stderr, "Invalid combination of options.\n");
         fprintf(stderr, "%s\n", USAGE);
@@ -661,85 +1648,139 @@ int main(int argc, char ** argv) {
         fprintf(stderr, "%s\n", USAGE);
         return 1;
     }
+    if(!options.cycleFlag && !options.pathFlag && options.spectrumFlag) {
+        fprintf(stderr, "Use -s only with -c or -p.\n");
+        fprintf(stderr, "%s\n", USAGE);
+        return 1;
+    }
 
-    int optionsNumber = (options.differenceFlag ? 1 : 0) |
-                        (options.forbiddenLength != -1 ? 2 : 0);
-
-    unsigned long long int counter = 0;
-    unsigned long long int skippedGraphs = 0;
-    unsigned long long int passedGraphs = 0;
-    unsigned long long int frequencies[BITSETSIZE] =
-     { [ 0 ... BITSETSIZE-1 ] = 0 };
-
-    clock_t start = clock();
-
-    //  Start looping over lines of stdin.
-    char * graphString = NULL;
-    size_t size;
-    while(getline(&graphString, &size, stdin) != -1) {
-
-        struct graph g;
-        g.nv = getNumberOfVertices(graphString);
-        if(g.nv == -1 || g.nv > BITSETSIZE - 1) {
-            fprintf(stderr, "Skipping invalid graph!\n");
-            skippedGraphs++;
-            continue;
-        }
-        bitset adjacencyList[g.nv];
-        if(loadGraph(graphString, g.nv, adjacencyList) == -1) {
-            fprintf(stderr, "Skipping invalid graph!\n");
-            skippedGraphs++;
-            continue;
-        }
-        g.adjacencyList = adjacencyList;
-        counter++;
-
-        // Length is largest length of (induced) cycle(or path). numberOfLenghts
-        // keeps track of each length encountered for the induced paths or
-        // cycles. Used for not counting forbidden induced cycle or path
-        // lengths.
-        int length;
-        unsigned long long int numberOfLengths[BITSETSIZE] = 
-         { [ 0 ... BITSETSIZE-1 ] = 0 };
-
-        if(options.cycleFlag) {
-            length = getLongestInducedCycleLength(&g, numberOfLengths);
+    // Color coding computes whether a cycle or path of the given length
+    // exists, by default we send the graphs in which it does to stdout.
+    char colorCodingTableString[64];
+    if(options.colorCodingLength == -1 &&
+     (options.deterministicFlag || options.colorCodingTrials != -1)) {
+        fprintf(stderr, "Use -D and -T# only with -k#.\n");
+        fprintf(stderr, "%s\n", USAGE);
+        return 1;
+    }
+    if(options.colorCodingLength != -1) {
+        if(options.cycleFlag || options.pathFlag || options.differenceFlag ||
+         options.symmetryFlag || options.hamiltonianCheck) {
+            fprintf(stderr, "Use -k# only with -l, -o#, -C, -G, -D or -T#.\n");
+            fprintf(stderr, "%s\n", USAGE);
+            return 1;
         }
-        else if(options.pathFlag) {
-            length = getLongestInducedPathLength(&g, numberOfLengths);
+        int maxLength = options.lengthFlag ? MAX_COLORS - 1 : MAX_COLORS;
+        if(options.colorCodingLength < 0 ||
+         options.colorCodingLength > maxLength) {
+            fprintf(stderr, "Error: -k# should be at most %d.\n", maxLength);
+            fprintf(stderr, "%s\n", USAGE);
+            return 1;
         }
-        else if(options.lengthFlag) {
-            length = getLength(&g, &options);
+        int numberOfColors = options.colorCodingLength + options.lengthFlag;
+        if(options.colorCodingTrials == -1) {
+            if(numberOfColors > MAX_COLORS_DEFAULT_TRIALS) {
+                fprintf(stderr, "Error: give -T# for %s with more than %d"
+                 " vertices, the default would be %lld colorings per graph.\n",
+                 options.lengthFlag ? "paths" : "cycles",
+                 MAX_COLORS_DEFAULT_TRIALS,
+                 getDefaultNumberOfTrials(numberOfColors));
+                fprintf(stderr, "%s\n", USAGE);
+                return 1;
+            }
+            options.colorCodingTrials = getDefaultNumberOfTrials(
+             numberOfColors);
         }
-        else {
-            length = getCircumference(&g, &options, EMPTY);
+        fprintf(stderr, "Trying up to %lld random colorings per graph, each"
+         " a dynamic program over 2^%d sets of colors.\n",
+         options.colorCodingTrials, numberOfColors);
+        sprintf(colorCodingTableString, "found %s of length %d",
+         options.lengthFlag ? "path" : "cycle", options.colorCodingLength);
+        tableString = colorCodingTableString;
+        if(options.output == -1) {
+            options.output = 1;
         }
+    }
 
-        if(shouldOutput(&g, length, numberOfLengths,  optionsNumber, &options)) {
-            passedGraphs++;
-            printf("%s", graphString);
+    // By default the Berge graphs are sent to stdout.
+    if(options.bergeFlag) {
+        if(options.cycleFlag || options.pathFlag || options.lengthFlag ||
+         options.colorCodingLength != -1 || options.differenceFlag) {
+            fprintf(stderr, "Use -B only with -o# or -C.\n");
+            fprintf(stderr, "%s\n", USAGE);
+            return 1;
         }
-        if(options.differenceFlag) {
-            frequencies[g.nv - length]++;
+        if(options.output == -1) {
+            options.output = 1;
         }
-        else {
-            frequencies[length]++;
+    }
+
+    // By default the K1- or K2-hamiltonian graphs are sent to stdout.
+    if(options.kHamiltonicity) {
+        if(options.cycleFlag || options.pathFlag || options.lengthFlag ||
+         options.colorCodingLength != -1 || options.differenceFlag ||
+         options.bergeFlag) {
+            fprintf(stderr, "Use -1 or -2 only with -o#, -x or -C.\n");
+            fprintf(stderr, "%s\n", USAGE);
+            return 1;
+        }
+        if(options.output == -1) {
+            options.output = 1;
         }
     }
+    if(options.certificateFlag && !options.kHamiltonicity) {
+        fprintf(stderr, "Use -x only with -1 or -2.\n");
+        fprintf(stderr, "%s\n", USAGE);
+        return 1;
+    }
+
+    unsigned long long int frequencies[BITSETSIZE] =
+     { [ 0 ... BITSETSIZE-1 ] = 0 };
+    unsigned long long int graphsWithLength[BITSETSIZE] =
+     { [ 0 ... BITSETSIZE-1 ] = 0 };
+    struct statistics statistics = {0};
+    statistics.frequencies = frequencies;
+    statistics.graphsWithLength = graphsWithLength;
+    statistics.seed = options.deterministicFlag ?
+     0x9E3779B97F4A7C15ULL : (unsigned long long int) time(NULL) * 2 + 1;
+
+    struct searchesOfVersions versions;
+    selectSearchesOfVersions(&options, &versions);
+
+    clock_t start = clock();
+
+    struct graphReader reader = {&options, &versions, &statistics};
+#ifdef USE_LARGE_BIT
+    pthread_attr_t attributes;
+    pthread_t thread;
+    pthread_attr_init(&attributes);
+    if(pthread_attr_setstacksize(&attributes, SEARCH_STACK_SIZE) != 0 ||
+     pthread_create(&thread, &attributes, checkGraphsFromStdin, &reader) != 0) {
+        fprintf(stderr, "Error: could not start a thread with a stack of %zu"
+         " bytes.\n", SEARCH_STACK_SIZE);
+        return 1;
+    }
+    pthread_join(thread, NULL);
+    pthread_attr_destroy(&attributes);
+#else
+    checkGraphsFromStdin(&reader);
+#endif
 
     clock_t end = clock();
     double time_spent = (double)(end - start) / CLOCKS_PER_SEC;
-    free(graphString);
 
     // Print data
     printTable(&options, frequencies, tableString);
+    if(options.spectrumFlag) {
+        printSpectrumTable(&options, graphsWithLength, statistics.counter);
+    }
 
     // Mention how many graphs were output
-    printNumberGraphsOutput(&options, passedGraphs, tableString);
+    printNumberGraphsOutput(&options, statistics.passedGraphs, tableString);
 
     // Mention how many graphs checked
     fprintf(stderr,"\rChecked %lld graphs in %f seconds.\n",
-     counter, time_spent);
+     statistics.counter, time_spent);
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,278 @@
+/**
+ * automorphisms.c
+ *
+ * A description of the methods can be found in the header file.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "bitset.h"
+#include "automorphisms.h"
+
+//  An ordered partition of the vertices. The trace summarises how the
+//  partition was obtained by refinement, so that partitions which can be
+//  mapped onto each other by an automorphism have the same trace. There is
+//  room for one cell per vertex, partitions live on the heap since a copy is
+//  made at every level of the search.
+struct partition {
+    int numberOfCells;
+    unsigned long long int trace;
+    bitset cells[];
+};
+
+static size_t sizeOfPartition(int numberOfVertices) {
+    return sizeof(struct partition) + numberOfVertices * sizeof(bitset);
+}
+
+//  Returns a new partition on the heap, which is a copy of p unless p is NULL.
+static struct partition *copyPartition(struct partition *p,
+int numberOfVertices) {
+    size_t bytes = sizeOfPartition(numberOfVertices);
+    struct partition *copy = malloc(bytes);
+    if(copy == NULL) {
+        fprintf(stderr, "Error: out of memory in computing orbits.\n");
+        exit(1);
+    }
+    if(p != NULL) memcpy(copy, p, bytes);
+    return copy;
+}
+
+static void addToTrace(struct partition *p, int value) {
+    p->trace = (p->trace ^ (unsigned long long int) value) *
+     0x100000001B3ULL;
+}
+
+//  Refines the partition until it is equitable, i.e. until every vertex of a
+//  cell has the same number of neighbours in each cell. The cells whose
+//  indices are in splitters are used to split the others first. Only cell
+//  indices and neighbour counts are used, never the labels of vertices.
+static void refinePartition(bitset adjacencyList[], struct partition *p,
+bitset splitters) {
+
+    while(!isEmpty(splitters)) {
+        int s = next(splitters, -1);
+        removeElement(splitters, s);
+        bitset splitter = p->cells[s];
+
+        for(int c = 0; c < p->numberOfCells; c++) {
+            if(size(p->cells[c]) == 1) continue;
+
+            // Collect the different numbers of neighbours in the splitter in
+            // increasing order.
+            int counts[BITSETSIZE];
+            int numberOfCounts = 0;
+            forEach(v, p->cells[c]) {
+                int count = size(intersection(adjacencyList[v], splitter));
+                int i = 0;
+                while(i < numberOfCounts && counts[i] < count) i++;
+                if(i < numberOfCounts && counts[i] == count) continue;
+                for(int j = numberOfCounts; j > i; j--) {
+                    counts[j] = counts[j - 1];
+                }
+                counts[i] = count;
+                numberOfCounts++;
+            }
+            if(numberOfCounts == 1) continue;
+
+            // The vertices with the smallest count stay in cell c, the others
+            // form new cells at the end.
+            bitset cell = p->cells[c];
+            for(int i = 0; i < numberOfCounts; i++) {
+                bitset part = EMPTY;
+                forEach(v, cell) {
+                    if(size(intersection(adjacencyList[v], splitter)) ==
+                     counts[i]) {
+                        add(part, v);
+                    }
+                }
+                int index = i == 0 ? c : p->numberOfCells++;
+                p->cells[index] = part;
+                add(splitters, index);
+                addToTrace(p, s);
+                addToTrace(p, index);
+                addToTrace(p, counts[i]);
+                addToTrace(p, size(part));
+            }
+        }
+    }
+}
+
+//  Puts vertex in a cell of its own and refines the result.
+static void individualise(bitset adjacencyList[], struct partition *p,
+int vertex) {
+    for(int c = 0; c < p->numberOfCells; c++) {
+        if(contains(p->cells[c], vertex)) {
+            removeElement(p->cells[c], vertex);
+            addToTrace(p, c);
+            break;
+        }
+    }
+    p->cells[p->numberOfCells++] = singleton(vertex);
+    refinePartition(adjacencyList, p, singleton(p->numberOfCells - 1));
+    addToTrace(p, p->numberOfCells);
+}
+
+//  Tries to find an automorphism mapping the i-th cell of p onto the i-th
+//  cell of q for all i. If one is found, it is stored in permutation.
+static bool findAutomorphism(bitset adjacencyList[], int numberOfVertices,
+struct partition *p, struct partition *q, int permutation[]) {
+
+    if(p->trace != q->trace || p->numberOfCells != q->numberOfCells) {
+        return false;
+    }
+
+    int c = 0;
+    while(c < p->numberOfCells && size(p->cells[c]) == 1) c++;
+
+    // Both partitions are discrete, check whether they define an
+    // automorphism.
+    if(c == p->numberOfCells) {
+        for(int i = 0; i < p->numberOfCells; i++) {
+            permutation[next(p->cells[i], -1)] = next(q->cells[i], -1);
+        }
+        for(int v = 0; v < numberOfVertices; v++) {
+            bitset image = EMPTY;
+            forEach(u, adjacencyList[v]) {
+                add(image, permutation[u]);
+            }
+            if(!equals(image, adjacencyList[permutation[v]])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Individualise the first vertex of the first non-trivial cell of p and
+    // try every vertex of the corresponding cell of q as its image.
+    struct partition *pIndividualised = copyPartition(p, numberOfVertices);
+    struct partition *qIndividualised = copyPartition(NULL, numberOfVertices);
+    individualise(adjacencyList, pIndividualised, next(p->cells[c], -1));
+    bool found = false;
+    forEach(image, q->cells[c]) {
+        memcpy(qIndividualised, q, sizeOfPartition(numberOfVertices));
+        individualise(adjacencyList, qIndividualised, image);
+        if(findAutomorphism(adjacencyList, numberOfVertices, pIndividualised,
+         qIndividualised, permutation)) {
+            found = true;
+            break;
+        }
+    }
+    free(pIndividualised);
+    free(qIndividualised);
+    return found;
+}
+
+static int findRoot(int parent[], int v) {
+    while(parent[v] != v) {
+        v = parent[v];
+    }
+    return v;
+}
+
+// Merges the sets of u and v, the smallest vertex becomes the root.
+static void mergeOrbits(int parent[], int u, int v) {
+    int rootOfU = findRoot(parent, u);
+    int rootOfV = findRoot(parent, v);
+    if(rootOfU < rootOfV) {
+        parent[rootOfV] = rootOfU;
+    }
+    else {
+        parent[rootOfU] = rootOfV;
+    }
+}
+
+int computeOrbits(bitset adjacencyList[], int numberOfVertices,
+int vertexColors[], int orbits[]) {
+
+    for(int v = 0; v < numberOfVertices; v++) {
+        orbits[v] = v;
+    }
+    if(numberOfVertices == 0) return 0;
+
+    // The initial partition has a cell for each color, ordered by color.
+    struct partition *initial = copyPartition(NULL, numberOfVertices);
+    initial->numberOfCells = 0;
+    initial->trace = 0;
+    bitset uncoloredVertices = complement(EMPTY, numberOfVertices);
+    while(!isEmpty(uncoloredVertices)) {
+        int color = vertexColors[next(uncoloredVertices, -1)];
+        forEach(v, uncoloredVertices) {
+            if(vertexColors[v] < color) color = vertexColors[v];
+        }
+        bitset cell = EMPTY;
+        forEach(v, uncoloredVertices) {
+            if(vertexColors[v] == color) add(cell, v);
+        }
+        initial->cells[initial->numberOfCells++] = cell;
+        uncoloredVertices = difference(uncoloredVertices, cell);
+    }
+    refinePartition(adjacencyList, initial,
+     complement(EMPTY, initial->numberOfCells));
+
+    int cellOfVertex[numberOfVertices];
+    for(int c = 0; c < initial->numberOfCells; c++) {
+        forEach(v, initial->cells[c]) {
+            cellOfVertex[v] = c;
+        }
+    }
+
+    // Vertices in the same orbit have the same trace after individualising
+    // them.
+    unsigned long long int traceOfVertex[numberOfVertices];
+    struct partition *p = copyPartition(NULL, numberOfVertices);
+    struct partition *q = copyPartition(NULL, numberOfVertices);
+    size_t bytes = sizeOfPartition(numberOfVertices);
+    for(int v = 0; v < numberOfVertices; v++) {
+        if(size(initial->cells[cellOfVertex[v]]) == 1) continue;
+        memcpy(p, initial, bytes);
+        individualise(adjacencyList, p, v);
+        traceOfVertex[v] = p->trace;
+    }
+
+    // Compare every vertex with the representatives of the orbits found so
+    // far. Every automorphism we find can merge many orbits at once.
+    int permutation[numberOfVertices];
+    for(int v = 0; v < numberOfVertices; v++) {
+        if(size(initial->cells[cellOfVertex[v]]) == 1) continue;
+        if(findRoot(orbits, v) != v) continue;
+        forEach(r, initial->cells[cellOfVertex[v]]) {
+            if(r >= v) break;
+            if(findRoot(orbits, r) != r || traceOfVertex[r] != traceOfVertex[v])
+             continue;
+            memcpy(p, initial, bytes);
+            memcpy(q, initial, bytes);
+            individualise(adjacencyList, p, r);
+            individualise(adjacencyList, q, v);
+            if(findAutomorphism(adjacencyList, numberOfVertices, p, q,
+             permutation)) {
+                for(int u = 0; u < numberOfVertices; u++) {
+                    mergeOrbits(orbits, u, permutation[u]);
+                }
+                break;
+            }
+        }
+    }
+
+    free(initial);
+    free(p);
+    free(q);
+
+    int numberOfOrbits = 0;
+    for(int v = 0; v < numberOfVertices; v++) {
+        orbits[v] = findRoot(orbits, v);
+        if(orbits[v] == v) numberOfOrbits++;
+    }
+    return numberOfOrbits;
+}
+
+int computeStabiliserOrbits(bitset adjacencyList[], int numberOfVertices,
+int vertex, int orbits[]) {
+    int vertexColors[numberOfVertices];
+    for(int v = 0; v < numberOfVertices; v++) {
+        vertexColors[v] = v == vertex ? 1 : 0;
+    }
+    return computeOrbits(adjacencyList, numberOfVertices, vertexColors, orbits);
+}
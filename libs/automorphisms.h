@@ -0,0 +1,48 @@
+/**
+ *  This header file contains functions for computing the orbits of the
+ *  automorphism group of a graph. Automorphisms are found by individualising
+ *  vertices and refining the resulting partitions until they are equitable,
+ *  similar to the approach of nauty, but without computing a canonical form.
+ * */
+
+#ifndef AUTOMORPHISMS
+#define AUTOMORPHISMS
+
+#include "bitset.h"
+
+/**
+ *  Computes the orbits of the group of automorphisms of the graph which
+ *  preserve the given coloring of the vertices.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *  @param  vertexColors    An array of ints containing a color for each
+ *   vertex. Automorphisms map every vertex to a vertex of the same color. Use
+ *   the same color for all vertices to obtain the orbits of the full
+ *   automorphism group.
+ *  @param  orbits  An array of ints in which for each vertex the smallest
+ *   vertex of its orbit will be stored.
+ *
+ *  @return The number of orbits.
+ * */
+int computeOrbits(bitset adjacencyList[], int numberOfVertices,
+int vertexColors[], int orbits[]);
+
+/**
+ *  Computes the orbits of the stabiliser of a vertex in the automorphism
+ *  group of the graph, i.e. the automorphisms fixing that vertex.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *  @param  vertex  The vertex which should be fixed.
+ *  @param  orbits  An array of ints in which for each vertex the smallest
+ *   vertex of its orbit under the stabiliser will be stored.
+ *
+ *  @return The number of orbits.
+ * */
+int computeStabiliserOrbits(bitset adjacencyList[], int numberOfVertices,
+int vertex, int orbits[]);
+
+#endif
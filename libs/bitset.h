@@ -9,14 +9,43 @@
 	#include "bitset128Vertices.h"
 	#define BITSETSIZE 128
 
+//  The 128-bit version using the __uint128_t type of the compiler.
+#elif defined(USE_128_BIT_INT)
+	#include "bitset128VerticesInt.h"
+	#define BITSETSIZE 128
+
+//  If the target supports AVX2, the 192- and 256-bit versions store a bitset
+//  in a single vector register. Define NO_AVX2 to use the array versions.
+#elif defined(USE_192_BIT) && defined(__AVX2__) && !defined(NO_AVX2)
+	#include "bitset256VerticesAVX2.h"
+	#define BITSETSIZE 192
+
 #elif defined(USE_192_BIT)
 	#include "bitset192Vertices.h"
 	#define BITSETSIZE 192
 
+#elif defined(USE_256_BIT) && defined(__AVX2__) && !defined(NO_AVX2)
+	#include "bitset256VerticesAVX2.h"
+	#define BITSETSIZE 256
+
 #elif defined(USE_256_BIT)
 	#include "bitset256Vertices.h"
 	#define BITSETSIZE 256
 
+//  The large version can hold 64 * BITSET_WORDS vertices, but its operations
+//  only take as long as the order of the current graph requires.
+#elif defined(USE_LARGE_BIT)
+	#ifndef BITSET_WORDS
+	#define BITSET_WORDS 16
+	#endif
+	#include "bitsetLargeVertices.h"
+	#define BITSETSIZE (64 * BITSET_WORDS)
+
+#endif
+
+//  Only the large version needs to know the order of the current graph.
+#ifndef resizeBitsets
+#define resizeBitsets(numberOfVertices)
 #endif
 
 #endif
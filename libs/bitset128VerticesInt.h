@@ -0,0 +1,94 @@
+// FOR GRAPHS UP TO 128 VERTICES, USING THE NATIVE 128-BIT INTEGER TYPE
+#ifndef BITSET_MACROS
+#define BITSET_MACROS
+
+#include <stdint.h>
+
+//  Bitset macros, we assume nodes are labeled 0,1,2,...
+typedef __uint128_t bitset;
+
+//  Returns an empty bitset.
+#define EMPTY (bitset) 0
+
+//  Returns a bitset containing only node.
+#define singleton(node) ((bitset) 1 << (node))
+
+//  Returns the union of set1 and set2.
+#define union(set1, set2) ((set1) | (set2))
+
+//  Returns the intersection of set1 and set2.
+#define intersection(set1, set2) ((set1) & (set2))
+
+//  Adds node to set.
+#define add(set, node) ((set) = union((set),singleton(node)))
+
+//  Returns set1\set2 (set difference).
+#define difference(set1, set2) ((set1) & ~(set2))
+
+//  Removes node from set.
+#define removeElement(set, node) ((set) = difference((set), singleton(node)))
+
+//  Check if set is empty.
+#define isEmpty(set) ((set) == 0)
+
+//  Returns the size of the set.
+#define size(set) (__builtin_popcountll((uint64_t) (set)) + \
+ __builtin_popcountll((uint64_t) ((set) >> 64)))
+
+//	Check if set1 equals set2.
+#define equals(set1, set2) ((set1) == (set2))
+
+//	Loops over all elements of the set. The set is evaluated once, the
+//	elements which are left are kept in element##Rest and the smallest one is
+//	removed in every step.
+#define forEach(element, set) forEachInCursor(element, (set))
+
+//	Loops over all elements of the set starting from start (not included).
+#define forEachAfterIndex(element, set, start) forEachInCursor(element, \
+ (start) >= 127 ? EMPTY : (set) >> ((start) + 1) << ((start) + 1))
+
+//	The outer loop runs only once and declares element, so that break and
+//	continue behave as in a single loop.
+#define forEachInCursor(element, set) \
+ for(int element = -1, element##Done = 0; !element##Done; element##Done = 1) \
+  for(bitset element##Rest = (set); \
+   ((element) = popSmallestElement(&element##Rest)) != -1; )
+
+//  Removes the smallest element of rest and returns it, or -1 if rest is
+//  empty.
+static inline int popSmallestElement(bitset *rest) {
+    if(*rest == 0) return -1;
+    uint64_t low = (uint64_t) *rest;
+    int element = low ? __builtin_ctzll(low) :
+     64 + __builtin_ctzll((uint64_t) (*rest >> 64));
+    *rest &= *rest - 1;
+    return element;
+}
+
+//  Returns the smallest element of set larger than current, or -1 if there is
+//  none. There is no builtin for counting the trailing zeros of a 128-bit
+//  integer, so the two halves are checked separately.
+static inline int nextElement(bitset set, int current) {
+    int start = current + 1;
+    if(start < 64) {
+        uint64_t low = (uint64_t) set & (~(uint64_t) 0 << start);
+        if(low) return __builtin_ctzll(low);
+        start = 64;
+    }
+    if(start < 128) {
+        uint64_t high = (uint64_t) (set >> 64) & (~(uint64_t) 0 << (start - 64));
+        if(high) return 64 + __builtin_ctzll(high);
+    }
+    return -1;
+}
+#define next(set, current) nextElement((set), (current))
+
+//  Checks whether node is an element of set.
+#define contains(set, node) ((int) ((set) >> (node)) & 1)
+
+//	Take the complement of a set in a universe consisting of sizeOfUniverse elements.
+//	E.g.: complement of {0,2} if there are only 4 elements is {1,3} and not 128-bit complement.
+#define complement(set, sizeOfUniverse) ((sizeOfUniverse) == 0 ? EMPTY : \
+ ~(set) << (128-(sizeOfUniverse)) >> (128-(sizeOfUniverse)))
+
+#endif
@@ -57,11 +57,61 @@ typedef struct bitset {uint64_t parts[4];} bitset;
 							((set1).parts[2] == (set2).parts[2]) &&\
 							((set1).parts[3] == (set2).parts[3]))
 
-//	Loops over all elements of the set. 
-#define forEach(element, set) for (int element = next((set), -1); (element) != -1; (element) = next((set), (element)))
+//	Loops over all elements of the set. The set is evaluated once, the
+//	elements which are left are kept in element##Rest and the smallest one is
+//	removed in every step.
+#define forEach(element, set) forEachInCursor(element, (set))
 
 //	Loops over all elements of the set starting from start (not included). 
-#define forEachAfterIndex(element, set, start) for (int element = next((set), (start)); (element) != -1; (element) = next((set), (element)))
+#define forEachAfterIndex(element, set, start) \
+ forEachInCursor(element, elementsAfter((set), (start)))
+
+//	The outer loop runs only once and declares element, so that break and
+//	continue behave as in a single loop.
+#define forEachInCursor(element, set) \
+ for(int element = -1, element##Done = 0; !element##Done; element##Done = 1) \
+  for(bitset element##Rest = (set); \
+   ((element) = popSmallestElement(&element##Rest)) != -1; )
+
+//	Removes the smallest element of rest and returns it, or -1 if rest is
+//	empty.
+static inline int popSmallestElement(bitset *rest) {
+    uint64_t part;
+    part = rest->parts[0];
+    if(part) {
+        rest->parts[0] = part & (part - 1);
+        return __builtin_ctzll(part);
+    }
+    part = rest->parts[1];
+    if(part) {
+        rest->parts[1] = part & (part - 1);
+        return 64 + __builtin_ctzll(part);
+    }
+    part = rest->parts[2];
+    if(part) {
+        rest->parts[2] = part & (part - 1);
+        return 128 + __builtin_ctzll(part);
+    }
+    part = rest->parts[3];
+    if(part) {
+        rest->parts[3] = part & (part - 1);
+        return 192 + __builtin_ctzll(part);
+    }
+    return -1;
+}
+
+//	Returns the elements of set larger than start.
+static inline bitset elementsAfter(bitset set, int start) {
+    for(int i = 0; i < 4; i++) {
+        if(start + 1 >= 64 * (i + 1)) {
+            (set).parts[i] = 0;
+        }
+        else if(start + 1 > 64 * i) {
+            (set).parts[i] &= ~(uint64_t) 0 << (start + 1 - 64 * i);
+        }
+    }
+    return set;
+}
 
 #define next(set, current)  (current < 63  ? safeNext0(set, current) : \
 							 current < 128 ? safeNext64(set, current) : \
@@ -88,7 +138,8 @@ typedef struct bitset {uint64_t parts[4];} bitset;
 //	Take the complement of a set in a universe consisting of sizeOfUniverse elements. 
 //	E.g.: complement of {0,2} if there are only 4 elements is {1,3} and not 64-bit complement. 
 //	Any 1's at position greater than sizeOfUniverse will be zero.
-#define complement(set, sizeOfUniverse) (sizeOfUniverse <= 64 ? (bitset) {~(set).parts[0] << (64-(sizeOfUniverse)) >> (64-(sizeOfUniverse)), (uint64_t) 0LL, (uint64_t) 0LL, (uint64_t) 0LL} : \
+#define complement(set, sizeOfUniverse) ((sizeOfUniverse) == 0 ? EMPTY : \
+ sizeOfUniverse <= 64 ? (bitset) {~(set).parts[0] << (64-(sizeOfUniverse)) >> (64-(sizeOfUniverse)), (uint64_t) 0LL, (uint64_t) 0LL, (uint64_t) 0LL} : \
 										sizeOfUniverse <= 128 ? (bitset) {~(set).parts[0], ~(set).parts[1] << (64 - ((sizeOfUniverse) - 64)) >> (64-((sizeOfUniverse) - 64) ), (uint64_t) 0LL, (uint64_t) 0LL} : \
 										sizeOfUniverse <= 192 ?	(bitset) {~(set).parts[0], ~(set).parts[1], ~(set).parts[2] << (64 - ((sizeOfUniverse) - 128)) >>  (64 - ((sizeOfUniverse) - 128)), (uint64_t) 0LL} : \
 																(bitset) {~(set).parts[0], ~(set).parts[1], ~(set).parts[2], ~(set).parts[3] << (64 - ((sizeOfUniverse) - 192)) >> (64 - ((sizeOfUniverse) - 192))})
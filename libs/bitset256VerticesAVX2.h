@@ -0,0 +1,154 @@
+// FOR GRAPHS UP TO 256 VERTICES, USING AVX2 INSTRUCTIONS
+#ifndef BITSET_MACROS
+#define BITSET_MACROS
+
+#include <stdint.h>
+#include <immintrin.h>
+
+//  Bitset macros, we assume nodes are labeled 0,1,2,...
+//  The bitset is a single 256-bit vector, part i contains the nodes 64i up to
+//  64i+63. Arrays of bitsets are also allocated with malloc, so we do not
+//  assume they are aligned to 32 bytes.
+typedef long long bitset __attribute__((vector_size(32), aligned(8)));
+
+//  Returns an empty bitset.
+#define EMPTY (bitset) {0LL, 0LL, 0LL, 0LL}
+
+//  Returns a bitset containing the nodes smaller than n, for n from 0 to 256.
+static inline bitset firstNodes(int n) {
+    __m256i count = _mm256_sub_epi64(_mm256_set1_epi64x(n),
+     _mm256_setr_epi64x(0, 64, 128, 192));
+    return (bitset) _mm256_andnot_si256(
+     _mm256_sllv_epi64(_mm256_set1_epi64x(-1), count),
+     _mm256_cmpgt_epi64(count, _mm256_setzero_si256()));
+}
+
+//  Returns a bitset containing only node.
+#define singleton(node) ((bitset) _mm256_and_si256( \
+	_mm256_cmpeq_epi64(_mm256_set1_epi64x((node) >> 6), _mm256_setr_epi64x(0, 1, 2, 3)), \
+	_mm256_set1_epi64x(1LL << ((node) & 63))))
+
+//  Returns the union of set1 and set2.
+#define union(set1, set2) ((set1) | (set2))
+
+//  Returns the intersection of set1 and set2.
+#define intersection(set1, set2) ((set1) & (set2))
+
+//  Adds node to set.
+#define add(set, node) ((set) = union((set),singleton(node)))
+
+//  Returns set1\set2 (set difference).
+#define difference(set1, set2) ((set1) & ~(set2))
+
+//  Removes node from set.
+#define removeElement(set, node) ((set) = difference((set), singleton(node)))
+
+//  Check if set is empty.
+static inline int isEmptyBitset(bitset set) {
+    return _mm256_testz_si256((__m256i) set, (__m256i) set);
+}
+#define isEmpty(set) isEmptyBitset(set)
+
+//  Returns the size of the set. With AVX-512 the four parts are counted by a
+//  single instruction.
+static inline int sizeOfBitset(bitset set) {
+#if defined(__AVX512VPOPCNTDQ__) && defined(__AVX512VL__)
+    bitset counts = (bitset) _mm256_popcnt_epi64((__m256i) set);
+    return counts[0] + counts[1] + counts[2] + counts[3];
+#else
+    return __builtin_popcountll(set[0]) + __builtin_popcountll(set[1]) +
+     __builtin_popcountll(set[2]) + __builtin_popcountll(set[3]);
+#endif
+}
+#define size(set) sizeOfBitset(set)
+
+#define equals(set1, set2) isEmpty((set1) ^ (set2))
+
+//  Loops over all elements of the set. The set is evaluated once, the
+//  elements which are left are kept in element##Rest and the smallest one is
+//  removed in every step.
+#define forEach(element, set) forEachInCursor(element, (set))
+
+//  Loops over all elements of the set starting from start (not included).
+#define forEachAfterIndex(element, set, start) \
+ forEachInCursor(element, elementsAfter((set), (start)))
+
+//  The outer loop runs only once and declares element, so that break and
+//  continue behave as in a single loop.
+#define forEachInCursor(element, set) \
+ for(int element = -1, element##Done = 0; !element##Done; element##Done = 1) \
+  for(bitset element##Rest = (set); \
+   ((element) = popSmallestElement(&element##Rest)) != -1; )
+
+//  Removes the smallest element of rest and returns it, or -1 if rest is
+//  empty.
+static inline int popSmallestElement(bitset *rest) {
+    uint64_t part;
+    part = (*rest)[0];
+    if(part) {
+        (*rest)[0] = part & (part - 1);
+        return __builtin_ctzll(part);
+    }
+    part = (*rest)[1];
+    if(part) {
+        (*rest)[1] = part & (part - 1);
+        return 64 + __builtin_ctzll(part);
+    }
+    part = (*rest)[2];
+    if(part) {
+        (*rest)[2] = part & (part - 1);
+        return 128 + __builtin_ctzll(part);
+    }
+    part = (*rest)[3];
+    if(part) {
+        (*rest)[3] = part & (part - 1);
+        return 192 + __builtin_ctzll(part);
+    }
+    return -1;
+}
+
+//  Returns the elements of set larger than start.
+static inline bitset elementsAfter(bitset set, int start) {
+    for(int i = 0; i < 4; i++) {
+        if(start + 1 >= 64 * (i + 1)) {
+            (set)[i] = 0;
+        }
+        else if(start + 1 > 64 * i) {
+            (set)[i] &= ~(uint64_t) 0 << (start + 1 - 64 * i);
+        }
+    }
+    return set;
+}
+
+//  Returns the smallest element of set larger than current, or -1 if there is
+//  none. The part containing current is checked first, the first non-empty
+//  part after it is found with a single comparison.
+static inline int nextElement(bitset set, int current) {
+    int part = (current + 1) >> 6;
+    if(part > 3) return -1;
+    uint64_t rest = (uint64_t) set[part] >> ((current + 1) & 63)
+     << ((current + 1) & 63);
+    if(rest) return 64 * part + __builtin_ctzll(rest);
+#ifdef __AVX512VL__
+    int nonEmptyParts = _mm256_test_epi64_mask((__m256i) set, (__m256i) set) &
+     (0xE << part);
+#else
+    int nonEmptyParts = ~_mm256_movemask_pd(_mm256_castsi256_pd(
+     _mm256_cmpeq_epi64((__m256i) set, _mm256_setzero_si256()))) &
+     (0xE << part) & 0xF;
+#endif
+    if(nonEmptyParts == 0) return -1;
+    part = __builtin_ctz(nonEmptyParts);
+    return 64 * part + __builtin_ctzll(set[part]);
+}
+#define next(set, current) nextElement((set), (current))
+
+//  Checks whether node is an element of set.
+#define contains(set, node) (((set)[(node) >> 6] >> ((node) & 63)) & 1)
+
+//	Take the complement of a set in a universe consisting of sizeOfUniverse elements.
+//	E.g.: complement of {0,2} if there are only 4 elements is {1,3} and not 64-bit complement.
+//	Any 1's at position greater than sizeOfUniverse will be zero.
+#define complement(set, sizeOfUniverse) difference(firstNodes(sizeOfUniverse), (set))
+
+#endif
@@ -36,11 +36,21 @@ typedef uint64_t bitset;
 //	Check if set1 equals set2.
 #define equals(set1, set2) ((set1) == (set2))
 
-//	Loops over all elements of the set. 
-#define forEach(element, set) for (int element = next((set), -1); (element) != -1; (element) = next((set), (element)))
+//	Loops over all elements of the set. The set is evaluated once, the
+//	elements which are left are kept in element##Rest and the smallest one is
+//	removed in every step. The outer loop runs only once and declares element,
+//	so that break and continue behave as in a single loop.
+#define forEach(element, set) forEachInCursor(element, (set))
 
 //	Loops over all elements of the set starting from start (not included). 
-#define forEachAfterIndex(element, set, start) for (int element = next((set), (start)); (element) != -1; (element) = next((set), (element)))
+#define forEachAfterIndex(element, set, start) forEachInCursor(element, \
+ (start) >= 63 ? EMPTY : (set) & (~(bitset) 0 << ((start) + 1)))
+
+#define forEachInCursor(element, set) \
+ for(int element = -1, element##Done = 0; !element##Done; element##Done = 1) \
+  for(bitset element##Rest = (set); !isEmpty(element##Rest) && \
+   ((element) = __builtin_ctzll(element##Rest), \
+   element##Rest &= element##Rest - 1, 1); )
 
 //  Returns -1 if the set is empty. Otherwise it executes unsafeNext(set, current).
 #define next(set, current)  (isEmpty(set) ? -1 : unsafeNext((set), (current)) ) //the builtin clz and ctz compiler functions have unexpected behavior at zero.
@@ -54,6 +64,7 @@ typedef uint64_t bitset;
 
 //	Take the complement of a set in a universe consisting of sizeOfUniverse elements. 
 //	E.g.: complement of {0,2} if there are only 4 elements is {1,3} and not 64-bit complement. 
-#define complement(set, sizeOfUniverse) (~(set) << (64-(sizeOfUniverse)) >> (64-(sizeOfUniverse)))
+#define complement(set, sizeOfUniverse) ((sizeOfUniverse) == 0 ? EMPTY : \
+ ~(set) << (64-(sizeOfUniverse)) >> (64-(sizeOfUniverse)))
 
 #endif
\ No newline at end of file
@@ -0,0 +1,169 @@
+// FOR GRAPHS UP TO 64 * BITSET_WORDS VERTICES
+#ifndef BITSET_MACROS
+#define BITSET_MACROS
+
+#include <stdint.h>
+
+//  Bitset macros, we assume nodes are labeled 0,1,2,...
+//  A bitset has room for 64 * BITSET_WORDS nodes, but the operations only use
+//  the first bitsetWords words. This is the number of words needed for the
+//  current graph, it is set by resizeBitsets before the graph is loaded. The
+//  other words of a bitset are never read, results are padded with zeroes.
+typedef struct bitset {uint64_t parts[BITSET_WORDS];} bitset;
+
+//  Defined in circumferenceChecker.c.
+extern int bitsetWords;
+
+//  Use bitsets for graphs of the given order from now on.
+#define resizeBitsets(numberOfVertices) \
+ (bitsetWords = (numberOfVertices) > 0 ? ((numberOfVertices) + 63) / 64 : 1)
+
+//  Returns an empty bitset.
+#define EMPTY (bitset) {{0}}
+
+//  Returns a bitset containing only node.
+static inline bitset singletonBitset(int node) {
+    bitset result = EMPTY;
+    result.parts[node >> 6] = (uint64_t) 1 << (node & 63);
+    return result;
+}
+#define singleton(node) singletonBitset(node)
+
+//  Returns the union of set1 and set2.
+static inline bitset unionOfBitsets(bitset set1, bitset set2) {
+    bitset result = EMPTY;
+    for(int i = 0; i < bitsetWords; i++) {
+        result.parts[i] = set1.parts[i] | set2.parts[i];
+    }
+    return result;
+}
+#define union(set1, set2) unionOfBitsets((set1), (set2))
+
+//  Returns the intersection of set1 and set2.
+static inline bitset intersectionOfBitsets(bitset set1, bitset set2) {
+    bitset result = EMPTY;
+    for(int i = 0; i < bitsetWords; i++) {
+        result.parts[i] = set1.parts[i] & set2.parts[i];
+    }
+    return result;
+}
+#define intersection(set1, set2) intersectionOfBitsets((set1), (set2))
+
+//  Adds node to set.
+#define add(set, node) ((set).parts[(node) >> 6] |= (uint64_t) 1 << ((node) & 63))
+
+//  Returns set1\set2 (set difference).
+static inline bitset differenceOfBitsets(bitset set1, bitset set2) {
+    bitset result = EMPTY;
+    for(int i = 0; i < bitsetWords; i++) {
+        result.parts[i] = set1.parts[i] & ~set2.parts[i];
+    }
+    return result;
+}
+#define difference(set1, set2) differenceOfBitsets((set1), (set2))
+
+//  Removes node from set.
+#define removeElement(set, node) ((set).parts[(node) >> 6] &= ~((uint64_t) 1 << ((node) & 63)))
+
+//  Check if set is empty.
+static inline int isEmptyBitset(bitset set) {
+    for(int i = 0; i < bitsetWords; i++) {
+        if(set.parts[i]) return 0;
+    }
+    return 1;
+}
+#define isEmpty(set) isEmptyBitset(set)
+
+//  Returns the size of the set.
+static inline int sizeOfBitset(bitset set) {
+    int size = 0;
+    for(int i = 0; i < bitsetWords; i++) {
+        size += __builtin_popcountll(set.parts[i]);
+    }
+    return size;
+}
+#define size(set) sizeOfBitset(set)
+
+//	Check if set1 equals set2.
+static inline int equalBitsets(bitset set1, bitset set2) {
+    for(int i = 0; i < bitsetWords; i++) {
+        if(set1.parts[i] != set2.parts[i]) return 0;
+    }
+    return 1;
+}
+#define equals(set1, set2) equalBitsets((set1), (set2))
+
+//  Loops over all elements of the set. The set is evaluated once, the
+//  elements which are left are kept in element##Rest and the smallest one is
+//  removed from the part element##Word in every step.
+#define forEach(element, set) forEachInCursor(element, (set))
+
+//  Loops over all elements of the set starting from start (not included). 
+#define forEachAfterIndex(element, set, start) \
+ forEachInCursor(element, elementsAfter((set), (start)))
+
+//  The outer loop runs only once and declares element, so that break and
+//  continue behave as in a single loop.
+#define forEachInCursor(element, set) \
+ for(int element = -1, element##Word = 0, element##Done = 0; !element##Done; \
+  element##Done = 1) \
+  for(bitset element##Rest = (set); \
+   ((element) = popSmallestElement(&element##Rest, &element##Word)) != -1; )
+
+//  Removes the smallest element of rest, looking from the part word onwards.
+//  Returns -1 if rest is empty.
+static inline int popSmallestElement(bitset *rest, int *word) {
+    while((*rest).parts[*word] == 0) {
+        if(++*word == bitsetWords) return -1;
+    }
+    uint64_t part = (*rest).parts[*word];
+    (*rest).parts[*word] = part & (part - 1);
+    return 64 * *word + __builtin_ctzll(part);
+}
+
+//  Returns the elements of set larger than start.
+static inline bitset elementsAfter(bitset set, int start) {
+    for(int i = 0; i < bitsetWords; i++) {
+        if(start + 1 >= 64 * (i + 1)) {
+            (set).parts[i] = 0;
+        }
+        else if(start + 1 > 64 * i) {
+            (set).parts[i] &= ~(uint64_t) 0 << (start + 1 - 64 * i);
+        }
+    }
+    return set;
+}
+
+//  Returns the smallest element of set larger than current, or -1 if there is
+//  none.
+static inline int nextElement(bitset set, int current) {
+    int word = (current + 1) >> 6;
+    if(word >= bitsetWords) return -1;
+    uint64_t rest = set.parts[word] & (~(uint64_t) 0 << ((current + 1) & 63));
+    while(!rest) {
+        if(++word >= bitsetWords) return -1;
+        rest = set.parts[word];
+    }
+    return 64 * word + __builtin_ctzll(rest);
+}
+#define next(set, current) nextElement((set), (current))
+
+//  Checks whether node is an element of set.
+#define contains(set, node) ((int) ((set).parts[(node) >> 6] >> ((node) & 63)) & 1)
+
+//	Take the complement of a set in a universe consisting of sizeOfUniverse elements.
+//	E.g.: complement of {0,2} if there are only 4 elements is {1,3}.
+//	Any 1's at position greater than sizeOfUniverse will be zero.
+static inline bitset complementOfBitset(bitset set, int sizeOfUniverse) {
+    bitset result = EMPTY;
+    for(int i = 0; i < bitsetWords; i++) {
+        int inUniverse = sizeOfUniverse - 64 * i;
+        result.parts[i] = inUniverse >= 64 ? ~set.parts[i] :
+         inUniverse <= 0 ? 0 :
+         ~set.parts[i] & (~(uint64_t) 0 >> (64 - inUniverse));
+    }
+    return result;
+}
+#define complement(set, sizeOfUniverse) complementOfBitset((set), (sizeOfUniverse))
+
+#endif
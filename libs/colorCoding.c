@@ -0,0 +1,146 @@
+/**
+ * colorCoding.c
+ *
+ * A description of the methods can be found in the header file.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "bitset.h"
+#include "colorCoding.h"
+
+unsigned long long int nextRandomNumber(unsigned long long int *seed) {
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
+
+long long int getDefaultNumberOfTrials(int numberOfColors) {
+
+    // A trial succeeds with probability p = k!/k^k for k colors, after t
+    // trials all of them failed with probability (1 - p)^t <= e^-pt.
+    double probability = 1;
+    for(int i = 1; i <= numberOfColors; i++) {
+        probability *= (double) i / numberOfColors;
+    }
+    return (long long int) (COLOR_CODING_CONFIDENCE / probability) + 1;
+}
+
+// Assign one of numberOfColors colors to each vertex at random.
+static void colorRandomly(int numberOfVertices, int numberOfColors,
+bitset colorClasses[], unsigned long long int *seed) {
+    for(int c = 0; c < numberOfColors; c++) {
+        colorClasses[c] = EMPTY;
+    }
+    for(int v = 0; v < numberOfVertices; v++) {
+        int color = nextRandomNumber(seed) % numberOfColors;
+        add(colorClasses[color], v);
+    }
+}
+
+static bitset *allocateColorSets(int numberOfColors) {
+    size_t size = ((size_t) 1 << numberOfColors) * sizeof(bitset);
+    bitset *reachable = malloc(size);
+    if(reachable == NULL) {
+        fprintf(stderr,
+         "Error: could not allocate %zu bytes for %d colors in color coding.\n",
+         size, numberOfColors);
+        exit(1);
+    }
+    return reachable;
+}
+
+//  After calling, reachable[colors] contains all vertices in which a colorful
+//  path using exactly the colors in colors ends. Only sets of colors which
+//  contain all colors in requiredColors are considered. The sets of the
+//  starting vertices of the paths should be filled in and all other
+//  considered sets should be empty.
+static void extendColorfulPaths(bitset adjacencyList[], int numberOfColors,
+bitset colorClasses[], bitset reachable[], int requiredColors) {
+
+    int fullSet = (1 << numberOfColors) - 1;
+
+    // Supersets are always larger numbers, so they are handled after their
+    // subsets.
+    for(int colors = requiredColors; colors < fullSet; colors++) {
+        if((colors & requiredColors) != requiredColors) continue;
+        if(isEmpty(reachable[colors])) continue;
+
+        bitset neighbours = EMPTY;
+        forEach(v, reachable[colors]) {
+            neighbours = union(neighbours, adjacencyList[v]);
+        }
+        for(int c = 0; c < numberOfColors; c++) {
+            if(colors & (1 << c)) continue;
+            reachable[colors | (1 << c)] = union(reachable[colors | (1 << c)],
+             intersection(neighbours, colorClasses[c]));
+        }
+    }
+}
+
+bool containsPathOfLength(bitset adjacencyList[], int numberOfVertices,
+int length, long long int trials, unsigned long long int *seed) {
+
+    int numberOfColors = length + 1;
+    if(numberOfColors > numberOfVertices) return false;
+    if(length == 0) return true;
+
+    bitset colorClasses[numberOfColors];
+    bitset *reachable = allocateColorSets(numberOfColors);
+    bool found = false;
+
+    for(long long int trial = 0; trial < trials && !found; trial++) {
+        colorRandomly(numberOfVertices, numberOfColors, colorClasses, seed);
+
+        // A colorful path can start in any vertex.
+        for(int colors = 0; colors < (1 << numberOfColors); colors++) {
+            reachable[colors] = EMPTY;
+        }
+        for(int c = 0; c < numberOfColors; c++) {
+            reachable[1 << c] = colorClasses[c];
+        }
+        extendColorfulPaths(adjacencyList, numberOfColors, colorClasses,
+         reachable, 0);
+        found = !isEmpty(reachable[(1 << numberOfColors) - 1]);
+    }
+
+    free(reachable);
+    return found;
+}
+
+bool containsCycleOfLength(bitset adjacencyList[], int numberOfVertices,
+int length, long long int trials, unsigned long long int *seed) {
+
+    int numberOfColors = length;
+    if(length < 3 || numberOfColors > numberOfVertices) return false;
+
+    bitset colorClasses[numberOfColors];
+    bitset *reachable = allocateColorSets(numberOfColors);
+    bool found = false;
+
+    for(long long int trial = 0; trial < trials && !found; trial++) {
+        colorRandomly(numberOfVertices, numberOfColors, colorClasses, seed);
+
+        // A colorful cycle contains exactly one vertex of color 0, we let
+        // the path start there.
+        forEach(start, colorClasses[0]) {
+            for(int colors = 1; colors < (1 << numberOfColors); colors += 2) {
+                reachable[colors] = EMPTY;
+            }
+            reachable[1] = singleton(start);
+            extendColorfulPaths(adjacencyList, numberOfColors, colorClasses,
+             reachable, 1);
+            if(!isEmpty(intersection(reachable[(1 << numberOfColors) - 1],
+             adjacencyList[start]))) {
+                found = true;
+                break;
+            }
+        }
+    }
+
+    free(reachable);
+    return found;
+}
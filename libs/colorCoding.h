@@ -0,0 +1,101 @@
+/**
+ *  This header file contains functions for deciding whether a graph contains
+ *  a path or cycle of a given length using color coding. Each trial colors
+ *  the vertices randomly and looks for a colorful path or cycle, i.e. one in
+ *  which all vertices have distinct colors, by dynamic programming over sets
+ *  of colors. A positive answer is always correct, a negative answer is
+ *  wrong with a probability that decreases exponentially in the number of
+ *  trials. A random coloring makes a fixed path or cycle on k vertices
+ *  colorful with probability k!/k^k, which is about e^-k, so the number of
+ *  trials needed for a given error rate grows exponentially in k.
+ * */
+
+#ifndef COLOR_CODING
+#define COLOR_CODING
+
+#include <stdbool.h>
+#include "bitset.h"
+
+//  The largest number of colors, i.e. vertices in the path or cycle, for which
+//  the dynamic program can be used. It needs 2^MAX_COLORS bitsets, which we
+//  keep at 128 MiB for every bitset size.
+#if BITSETSIZE <= 64
+    #define MAX_COLORS 24
+#elif BITSETSIZE <= 128
+    #define MAX_COLORS 23
+#elif BITSETSIZE <= 256
+    #define MAX_COLORS 22
+#elif BITSETSIZE <= 512
+    #define MAX_COLORS 21
+#elif BITSETSIZE <= 1024
+    #define MAX_COLORS 20
+#else
+    #define MAX_COLORS 19
+#endif
+
+//  The default number of trials is chosen such that a path or cycle which
+//  exists is missed with probability at most e^-COLOR_CODING_CONFIDENCE.
+#define COLOR_CODING_CONFIDENCE 7
+
+//  The default number of trials is only used for paths and cycles with at
+//  most this many vertices, about 130 thousand trials. Each vertex more
+//  multiplies the default by about e and the work per trial by 2, so for
+//  longer paths and cycles the number of trials has to be given explicitly.
+#define MAX_COLORS_DEFAULT_TRIALS 12
+
+/**
+ *  Returns a pseudorandom number using a xorshift generator and updates its
+ *  state.
+ *
+ *  @param  seed    Pointer to the non-zero state of the generator.
+ *
+ *  @return A pseudorandom 64-bit number.
+ * */
+unsigned long long int nextRandomNumber(unsigned long long int *seed);
+
+/**
+ *  Returns the number of random colorings which need to be tried such that a
+ *  path or cycle with the given number of vertices, if it exists, is missed
+ *  with probability at most e^-COLOR_CODING_CONFIDENCE.
+ *
+ *  @param  numberOfColors  The number of vertices in the path or cycle.
+ *
+ *  @return The number of trials.
+ * */
+long long int getDefaultNumberOfTrials(int numberOfColors);
+
+/**
+ *  Returns a boolean indicating whether a path with the given number of
+ *  edges was found in the graph.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *  @param  length  The number of edges of the path. Should be less than
+ *   MAX_COLORS.
+ *  @param  trials  The number of random colorings which are tried.
+ *  @param  seed    Pointer to the state of the random number generator.
+ *
+ *  @return True if a path of the given length was found, false otherwise.
+ * */
+bool containsPathOfLength(bitset adjacencyList[], int numberOfVertices,
+int length, long long int trials, unsigned long long int *seed);
+
+/**
+ *  Returns a boolean indicating whether a cycle of the given length was found
+ *  in the graph.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *  @param  length  The number of edges (and vertices) of the cycle. Should be
+ *   at most MAX_COLORS.
+ *  @param  trials  The number of random colorings which are tried.
+ *  @param  seed    Pointer to the state of the random number generator.
+ *
+ *  @return True if a cycle of the given length was found, false otherwise.
+ * */
+bool containsCycleOfLength(bitset adjacencyList[], int numberOfVertices,
+int length, long long int trials, unsigned long long int *seed);
+
+#endif
@@ -8,12 +8,42 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdbool.h>
 #include "bitset.h"
 #include "hamiltonicityMethods.h"
+#include "automorphisms.h"
+
+bitset getVerticesWithTwoNeighboursIn(bitset adjacencyList[], bitset
+vertices) {
+    bitset atLeastOnce = EMPTY;
+    bitset atLeastTwice = EMPTY;
+    forEach(vertex, vertices) {
+        atLeastTwice = union(atLeastTwice,
+         intersection(atLeastOnce, adjacencyList[vertex]));
+        atLeastOnce = union(atLeastOnce, adjacencyList[vertex]);
+    }
+    return atLeastTwice;
+}
 
-bool canBeHamiltonian(bitset adjacencyList[], bitset remainingVertices, int
-lastElemOfPath, int firstElemOfPath, int numberOfVertices, int pathLength) {
+bitset getVerticesWithLowDegreeIn(bitset adjacencyList[], bitset candidates,
+bitset vertices) {
+    bitset lowDegreeVertices = EMPTY;
+    forEach(vertex, candidates) {
+        if(size(intersection(adjacencyList[vertex], vertices)) < 2) {
+            add(lowDegreeVertices, vertex);
+        }
+    }
+    return lowDegreeVertices;
+}
+
+//  The recursive part of canBeHamiltonian. All remaining vertices have at
+//  least two neighbours which are remaining vertices or endpoints of the path.
+//  If pathList is not NULL, the vertices of the path are stored in it at the
+//  index of their position, so that it contains the cycle if one is found.
+static bool extendToHamiltonianCycle(bitset adjacencyList[], bitset
+remainingVertices, int pathList[], int lastElemOfPath, int firstElemOfPath,
+int numberOfVertices, int pathLength) {
 
     // Check whether we have a Hamiltonian path already and whether this path
     // is a cycle.
@@ -26,51 +56,45 @@ lastElemOfPath, int firstElemOfPath, int numberOfVertices, int pathLength) {
         return false;
     }
 
-    // Check for all elements not yet visited whether they still have two
-    // neighbours to which they can connect.
-    bitset remainingWithFirstAndLast = 
-     union(remainingVertices, union(singleton(firstElemOfPath), singleton(lastElemOfPath)));
-    forEach(vertex, remainingVertices) {
-
-        //  Neighbours which either do not lie in the path, or which are one
-        //  of its endpoints.
-        bitset remainingNeighbours = 
-         intersection(adjacencyList[vertex], remainingWithFirstAndLast );
-
-        //  If there is only one such neighbour or less, our path cannot be
-        //  extended through this vertex into a hamiltonian cycle.
-        if(size(remainingNeighbours) < 2) return false;
-    }
-
     // Create a bitset of the neighbours of the last element in the path which
     // do not belong to the path. The path will be extended via these
     // neighbours.
     bitset neighboursOfLastNotInPath = 
      intersection(adjacencyList[lastElemOfPath], remainingVertices);
-    forEach(neighbour, neighboursOfLastNotInPath) {
 
-        //  Save the current last element of path. If an extension cannot be a
-        //  hamiltonian cycle, we need to try the other possible extensions
-        //  for this path.
-        int oldElemOfPath = lastElemOfPath;
+    //  In every extension the last element becomes an inner vertex of the
+    //  path, so only the degrees of its neighbours decrease. A remaining
+    //  vertex which then has less than two neighbours to which it can
+    //  connect, can only be the next vertex of the path, since it then only
+    //  needs one more. If there is more than one such vertex, no extension
+    //  works.
+    bitset lowDegreeVertices = getVerticesWithLowDegreeIn(adjacencyList,
+     neighboursOfLastNotInPath, union(remainingVertices,
+     singleton(firstElemOfPath)));
+    if(!isEmpty(lowDegreeVertices)) {
+        if(size(lowDegreeVertices) > 1) return false;
+        neighboursOfLastNotInPath = lowDegreeVertices;
+    }
 
-        //  Extend the path with neighbour, which is a neighbour oldElemOfPath
-        //  that does no belong to the path yet.
+    forEach(neighbour, neighboursOfLastNotInPath) {
+
+        //  Extend the path with neighbour, which is a neighbour of
+        //  lastElemOfPath that does no belong to the path yet.
         removeElement(remainingVertices, neighbour);
-        lastElemOfPath = neighbour; // Neighbour is the new last element.
+        if(pathList != NULL) pathList[pathLength] = neighbour;
 
         //  If this extension can become a hamiltonian cycle, so can the
         //  current path.
-        if (canBeHamiltonian(adjacencyList, remainingVertices, lastElemOfPath,
-         firstElemOfPath, numberOfVertices, pathLength + 1)) {
+        if (extendToHamiltonianCycle(adjacencyList, remainingVertices,
+         pathList, neighbour, firstElemOfPath, numberOfVertices,
+         pathLength + 1)) {
             return true;
         }
 
         //  If we reach this part, the extension could not become a
         //  hamiltonian cycle, hence we need to look again at the other
         //  possible extensions for our old path.
-        add(remainingVertices, lastElemOfPath);
-        lastElemOfPath = oldElemOfPath;
+        add(remainingVertices, neighbour);
     }
 
     //  None of the possible extensions worked, so the path cannot be a
@@ -78,6 +102,36 @@ lastElemOfPath, int firstElemOfPath, int numberOfVertices, int pathLength) {
     return false;
 }
 
+//  The search of canBeHamiltonian, which also stores the cycle in pathList if
+//  it is not NULL.
+static bool canBeHamiltonianRecordPath(bitset adjacencyList[], bitset
+remainingVertices, int pathList[], int lastElemOfPath, int firstElemOfPath,
+int numberOfVertices, int pathLength) {
+
+    // Check for all elements not yet visited whether they still have two
+    // neighbours to which they can connect, i.e. neighbours which either do
+    // not lie in the path, or which are one of its endpoints. If there is
+    // only one such neighbour or less, our path cannot be extended through
+    // this vertex into a hamiltonian cycle. During the search only the
+    // vertices whose degree changed are checked again.
+    bitset remainingWithFirstAndLast = 
+     union(remainingVertices, union(singleton(firstElemOfPath), singleton(lastElemOfPath)));
+    if(!isEmpty(difference(remainingVertices,
+     getVerticesWithTwoNeighboursIn(adjacencyList,
+     remainingWithFirstAndLast)))) {
+        return false;
+    }
+
+    return extendToHamiltonianCycle(adjacencyList, remainingVertices,
+     pathList, lastElemOfPath, firstElemOfPath, numberOfVertices, pathLength);
+}
+
+bool canBeHamiltonian(bitset adjacencyList[], bitset remainingVertices, int
+lastElemOfPath, int firstElemOfPath, int numberOfVertices, int pathLength) {
+    return canBeHamiltonianRecordPath(adjacencyList, remainingVertices, NULL,
+     lastElemOfPath, firstElemOfPath, numberOfVertices, pathLength);
+}
+
 
 bool canBeHamiltonianPrintCycle(bitset adjacencyList[], bitset
 remainingVertices, int pathList[], int lastElemOfPath, int firstElemOfPath,
@@ -103,19 +157,16 @@ allCyclesFlag, bool verboseFlag) {
     }
 
     // Check for all elements not yet visited whether they still have two
-    // neighbours to which they can connect.
+    // neighbours to which they can connect, i.e. neighbours which either do
+    // not lie in the path, or which are one of its endpoints. If there is
+    // only one such neighbour or less, our path cannot be extended through
+    // this vertex into a hamiltonian cycle.
     bitset remainingWithFirstAndLast = 
      union(remainingVertices, union(singleton(firstElemOfPath), singleton(lastElemOfPath)));
-    forEach(vertex, remainingVertices) {
-
-        //  Neighbours which either do not lie in the path, or which are one
-        //  of its endpoints.
-        bitset remainingNeighbours = 
-         intersection(adjacencyList[vertex], remainingWithFirstAndLast );
-
-        //  If there is only one such neighbour or less, our path cannot be
-        //  extended through this vertex into a hamiltonian cycle.
-        if(size(remainingNeighbours) < 2) return false;
+    if(!isEmpty(difference(remainingVertices,
+     getVerticesWithTwoNeighboursIn(adjacencyList,
+     remainingWithFirstAndLast)))) {
+        return false;
     }
 
     // Create a bitset of the neighbours of the last element in the path which
@@ -249,8 +300,10 @@ degree) {
 bool isK1Hamiltonian(bitset adjacencyList[], int numberOfVertices, bool
 verboseFlag, bool allCyclesFlag, int vertexToCheck) {
 
-    //  Graphs with minimum degree < 3 cannot be K1-hamiltonian.
-    if(!hasMinimumDegree(adjacencyList,numberOfVertices,3)) {
+    //  Graphs with minimum degree < 3 cannot be K1-hamiltonian, neither can
+    //  the graph without vertices.
+    if(numberOfVertices == 0 ||
+     !hasMinimumDegree(adjacencyList,numberOfVertices,3)) {
         if(verboseFlag) {
             fprintf(stderr, "Graph does not have minimum degree 3.\n");
         }
@@ -261,11 +314,26 @@ verboseFlag, bool allCyclesFlag, int vertexToCheck) {
     //  non-hamiltonian. 
     bitset exceptionalVertices = EMPTY;
 
+    //  Without -v it suffices to check one vertex of each orbit of the
+    //  automorphism group, since G - v and G - w are isomorphic if v and w are
+    //  in the same orbit.
+    int orbits[numberOfVertices];
+    if(!verboseFlag) {
+        int vertexColors[numberOfVertices];
+        for (int i = 0; i < numberOfVertices; i++) {
+            vertexColors[i] = 0;
+        }
+        computeOrbits(adjacencyList, numberOfVertices, vertexColors, orbits);
+    }
+
     //  Loop over all vertices and determine whether the vertex-deleted
     //  subgraph is hamiltonian.
     for (int i = 0; i < numberOfVertices; i++) {
         bitset excludedVertices = singleton(i);
         if(!verboseFlag) {
+            if(orbits[i] != i) {
+                continue;
+            }
             if(!(isHamiltonian(adjacencyList,numberOfVertices,excludedVertices,
              false, false))) {
                 return false;
@@ -312,8 +380,10 @@ verboseFlag, bool allCyclesFlag, int vertexToCheck) {
 bool isK2Hamiltonian(bitset adjacencyList[], int numberOfVertices, bool
 verboseFlag, bool allCyclesFlag, int vertexPairToCheck[]) {
 
-    //  Graphs with minimum degree < 3 cannot be K2-hamiltonian.
-    if(!hasMinimumDegree(adjacencyList,numberOfVertices,3)) {
+    //  Graphs with minimum degree < 3 cannot be K2-hamiltonian, neither can
+    //  the graph without vertices.
+    if(numberOfVertices == 0 ||
+     !hasMinimumDegree(adjacencyList,numberOfVertices,3)) {
         if(verboseFlag) {
             fprintf(stderr, "Graph does not have minimum degree 3.\n");
         }
@@ -329,20 +399,45 @@ verboseFlag, bool allCyclesFlag, int vertexPairToCheck[]) {
     }
     bool encounteredNonHamSubgraph = false;
 
+    //  Without -v it suffices to check one edge of each orbit of edges under
+    //  the automorphism group. We check the edges vw where v is the smallest
+    //  vertex of its orbit and w the smallest vertex of its orbit under the
+    //  stabiliser of v.
+    if(!verboseFlag) {
+        int orbits[numberOfVertices];
+        int vertexColors[numberOfVertices];
+        for (int i = 0; i < numberOfVertices; i++) {
+            vertexColors[i] = 0;
+        }
+        computeOrbits(adjacencyList, numberOfVertices, vertexColors, orbits);
+        for (int i = 0; i < numberOfVertices; i++) {
+            if(orbits[i] != i) {
+                continue;
+            }
+            int stabiliserOrbits[numberOfVertices];
+            computeStabiliserOrbits(adjacencyList, numberOfVertices, i,
+             stabiliserOrbits);
+            forEach(neighbour, adjacencyList[i]) {
+                if(stabiliserOrbits[neighbour] != neighbour) {
+                    continue;
+                }
+                bitset excludedVertices = singleton(i);
+                add(excludedVertices, neighbour);
+                if(!(isHamiltonian(adjacencyList, numberOfVertices,
+                 excludedVertices, false, false))){
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
     //  Loop over all edges vw with v < w and check if G - v - w is
     //  hamiltonian.
     for (int i = 0; i < numberOfVertices; i++) {
         bitset excludedVertices = singleton(i);
         forEachAfterIndex(neighbour, adjacencyList[i], i) {
             add(excludedVertices, neighbour);
-            if(!verboseFlag) {
-                if(!(isHamiltonian(adjacencyList, numberOfVertices,
-                 excludedVertices, false, false))){
-                    return false;
-                }
-                removeElement(excludedVertices, neighbour);
-                continue;
-            }
 
             //  Gets executed if -v is present.
             bool verbose = false;
@@ -382,6 +477,275 @@ verboseFlag, bool allCyclesFlag, int vertexPairToCheck[]) {
     return !encounteredNonHamSubgraph;
 }
 
+//  Stores a hamiltonian cycle of the subgraph spanned by the vertices not in
+//  excludedVertices in cycle and returns true, or returns false if there is
+//  none. The search is the same as in isHamiltonian.
+static bool findHamiltonianCycle(bitset adjacencyList[], int numberOfVertices,
+bitset excludedVertices, int cycle[]) {
+    bitset includedVertices = complement(excludedVertices, numberOfVertices);
+    if(size(includedVertices) < 3) return false;
+
+    //  Find an included vertex of lowest degree.
+    int startingVertex = next(includedVertices,-1);
+    int lowestDegree = numberOfVertices;
+    forEach(includedVertex, includedVertices) {
+        int degree = 
+         size(intersection(adjacencyList[includedVertex], includedVertices));
+        if(lowestDegree > degree) {
+            lowestDegree = degree;
+            startingVertex = includedVertex;
+        }
+    }
+
+    bitset neighbours =
+     intersection(adjacencyList[startingVertex], includedVertices);
+    forEach(secondElemOfPath, neighbours) {
+        forEachAfterIndex(lastElemOfPath, neighbours, secondElemOfPath) {
+            bitset path = singleton(startingVertex);
+            add(path, lastElemOfPath);
+            add(path, secondElemOfPath);
+            bitset remainingVertices = difference(includedVertices, path);
+
+            cycle[0] = lastElemOfPath;
+            cycle[1] = startingVertex;
+            cycle[2] = secondElemOfPath;
+            if(canBeHamiltonianRecordPath(adjacencyList, remainingVertices,
+             cycle, secondElemOfPath, lastElemOfPath, size(includedVertices),
+             3)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+//  Given a cycle of length n - 1 missing the vertex missed, every vertex of
+//  the cycle whose neighbours on the cycle are both adjacent to missed can be
+//  swapped with it. This yields a cycle missing that vertex instead. All
+//  vertices certified like this, directly or by swapping again, are added
+//  to certifiedOrbits, together with their orbit.
+static void certifyVertexBySwaps(bitset adjacencyList[], int numberOfVertices,
+int orbits[], bitset *certifiedOrbits, int cycle[], int missed) {
+    int length = numberOfVertices - 1;
+    int (*cycles)[length] = malloc(sizeof(int[numberOfVertices][length]));
+    if(cycles == NULL) {
+        fprintf(stderr, "Error: out of memory.\n");
+        exit(1);
+    }
+    int missedVertices[numberOfVertices];
+    int numberOfCycles = 0;
+
+    for(int i = 0; i < length; i++) {
+        cycles[0][i] = cycle[i];
+    }
+    missedVertices[numberOfCycles++] = missed;
+    add(*certifiedOrbits, orbits[missed]);
+
+    while(numberOfCycles) {
+        numberOfCycles--;
+        int *current = cycles[numberOfCycles];
+        int m = missedVertices[numberOfCycles];
+        int copy[length];
+        for(int i = 0; i < length; i++) {
+            copy[i] = current[i];
+        }
+        for(int i = 0; i < length; i++) {
+            int u = copy[i];
+            if(contains(*certifiedOrbits, orbits[u])) continue;
+            if(!contains(adjacencyList[m], copy[(i + length - 1) % length]) ||
+             !contains(adjacencyList[m], copy[(i + 1) % length])) {
+                continue;
+            }
+            add(*certifiedOrbits, orbits[u]);
+            for(int j = 0; j < length; j++) {
+                cycles[numberOfCycles][j] = copy[j];
+            }
+            cycles[numberOfCycles][i] = m;
+            missedVertices[numberOfCycles++] = u;
+        }
+    }
+    free(cycles);
+}
+
+//  Marks the edge vw as certified if it was not yet. Returns true if it was
+//  newly certified.
+static bool certifyEdge(bitset uncoveredNeighbours[], int v, int w) {
+    if(!contains(uncoveredNeighbours[v], w)) return false;
+    removeElement(uncoveredNeighbours[v], w);
+    removeElement(uncoveredNeighbours[w], v);
+    return true;
+}
+
+//  Given a cycle of length n - 2 missing the adjacent vertices m1 and m2, a
+//  vertex u of the cycle can be replaced by m1 if both its neighbours on the
+//  cycle are adjacent to m1, yielding a cycle missing u and m2. Similarly two
+//  consecutive vertices x, y of the cycle can be replaced by m1, m2 in some
+//  order, yielding a cycle missing x and y. Missed pairs which are edges are
+//  certified, directly or by swapping again.
+static void certifyEdgeBySwaps(bitset adjacencyList[], int numberOfVertices,
+bitset uncoveredNeighbours[], int cycle[], int m1, int m2) {
+    int length = numberOfVertices - 2;
+    int maximumNumberOfCycles = numberOfVertices * numberOfVertices / 2 + 1;
+    int (*cycles)[length] = malloc(sizeof(int[maximumNumberOfCycles][length]));
+    int (*missedPairs)[2] = malloc(sizeof(int[maximumNumberOfCycles][2]));
+    if(cycles == NULL || missedPairs == NULL) {
+        fprintf(stderr, "Error: out of memory.\n");
+        exit(1);
+    }
+    int numberOfCycles = 0;
+
+    for(int i = 0; i < length; i++) {
+        cycles[0][i] = cycle[i];
+    }
+    missedPairs[0][0] = m1;
+    missedPairs[0][1] = m2;
+    numberOfCycles++;
+    certifyEdge(uncoveredNeighbours, m1, m2);
+
+    while(numberOfCycles) {
+        numberOfCycles--;
+        int copy[length];
+        for(int i = 0; i < length; i++) {
+            copy[i] = cycles[numberOfCycles][i];
+        }
+        int missed[2] = {missedPairs[numberOfCycles][0],
+         missedPairs[numberOfCycles][1]};
+
+        for(int i = 0; i < length; i++) {
+            int before = copy[(i + length - 1) % length];
+            int after = copy[(i + 1) % length];
+            int afterNext = copy[(i + 2) % length];
+
+            //  Replace copy[i] by one of the missed vertices.
+            for(int k = 0; k < 2; k++) {
+                int in = missed[k];
+                int other = missed[1 - k];
+                if(!contains(adjacencyList[in], before) ||
+                 !contains(adjacencyList[in], after) ||
+                 !contains(adjacencyList[other], copy[i]) ||
+                 !certifyEdge(uncoveredNeighbours, other, copy[i])) {
+                    continue;
+                }
+                for(int j = 0; j < length; j++) {
+                    cycles[numberOfCycles][j] = copy[j];
+                }
+                cycles[numberOfCycles][i] = in;
+                missedPairs[numberOfCycles][0] = other;
+                missedPairs[numberOfCycles][1] = copy[i];
+                numberOfCycles++;
+            }
+
+            //  Replace copy[i], copy[i + 1] by both missed vertices.
+            if(length < 3) continue;
+            for(int k = 0; k < 2; k++) {
+                if(!contains(adjacencyList[missed[k]], before) ||
+                 !contains(adjacencyList[missed[1 - k]], afterNext) ||
+                 !certifyEdge(uncoveredNeighbours, copy[i], after)) {
+                    continue;
+                }
+                for(int j = 0; j < length; j++) {
+                    cycles[numberOfCycles][j] = copy[j];
+                }
+                cycles[numberOfCycles][i] = missed[k];
+                cycles[numberOfCycles][(i + 1) % length] = missed[1 - k];
+                missedPairs[numberOfCycles][0] = copy[i];
+                missedPairs[numberOfCycles][1] = after;
+                numberOfCycles++;
+            }
+        }
+    }
+    free(cycles);
+    free(missedPairs);
+}
+
+bool isK1HamiltonianByCertificates(bitset adjacencyList[], int
+numberOfVertices) {
+
+    //  Graphs with minimum degree < 3 cannot be K1-hamiltonian, neither can
+    //  the graph without vertices.
+    if(numberOfVertices == 0 ||
+     !hasMinimumDegree(adjacencyList,numberOfVertices,3)) {
+        return false;
+    }
+
+    //  It suffices to certify one vertex of each orbit.
+    int orbits[numberOfVertices];
+    int vertexColors[numberOfVertices];
+    for (int i = 0; i < numberOfVertices; i++) {
+        vertexColors[i] = 0;
+    }
+    computeOrbits(adjacencyList, numberOfVertices, vertexColors, orbits);
+    bitset certifiedOrbits = EMPTY;
+
+    //  Only search for a hamiltonian cycle in G - i if i was not certified by
+    //  the cycles found so far.
+    int cycle[numberOfVertices];
+    for (int i = 0; i < numberOfVertices; i++) {
+        if(orbits[i] != i || contains(certifiedOrbits, i)) {
+            continue;
+        }
+        if(!findHamiltonianCycle(adjacencyList, numberOfVertices, singleton(i),
+         cycle)) {
+            return false;
+        }
+        certifyVertexBySwaps(adjacencyList, numberOfVertices, orbits,
+         &certifiedOrbits, cycle, i);
+    }
+    return true;
+}
+
+bool isK2HamiltonianByCertificates(bitset adjacencyList[], int
+numberOfVertices) {
+
+    //  Graphs with minimum degree < 3 cannot be K2-hamiltonian, neither can
+    //  the graph without vertices.
+    if(numberOfVertices == 0 ||
+     !hasMinimumDegree(adjacencyList,numberOfVertices,3)) {
+        return false;
+    }
+
+    bitset uncoveredNeighbours[numberOfVertices];
+    for (int i = 0; i < numberOfVertices; i++) {
+        uncoveredNeighbours[i] = adjacencyList[i];
+    }
+
+    //  It suffices to certify one edge of each orbit of edges. We search for
+    //  a hamiltonian cycle in G - i - neighbour, where i is the smallest
+    //  vertex of its orbit and neighbour the smallest vertex of its orbit
+    //  under the stabiliser of i, if the edge was not certified by the
+    //  cycles found so far.
+    int orbits[numberOfVertices];
+    int vertexColors[numberOfVertices];
+    for (int i = 0; i < numberOfVertices; i++) {
+        vertexColors[i] = 0;
+    }
+    computeOrbits(adjacencyList, numberOfVertices, vertexColors, orbits);
+    int cycle[numberOfVertices];
+    for (int i = 0; i < numberOfVertices; i++) {
+        if(orbits[i] != i) {
+            continue;
+        }
+        int stabiliserOrbits[numberOfVertices];
+        computeStabiliserOrbits(adjacencyList, numberOfVertices, i,
+         stabiliserOrbits);
+        forEach(neighbour, adjacencyList[i]) {
+            if(stabiliserOrbits[neighbour] != neighbour ||
+             !contains(uncoveredNeighbours[i], neighbour)) {
+                continue;
+            }
+            bitset excludedVertices = singleton(i);
+            add(excludedVertices, neighbour);
+            if(!findHamiltonianCycle(adjacencyList, numberOfVertices,
+             excludedVertices, cycle)) {
+                return false;
+            }
+            certifyEdgeBySwaps(adjacencyList, numberOfVertices,
+             uncoveredNeighbours, cycle, i, neighbour);
+        }
+    }
+    return true;
+}
+
 int containsHamiltonianPathWithEnds(bitset adjacencyList[], int
 numberOfVertices, bitset excludedVertices, int start, int end, bool
 allCyclesFlag, bool verboseFlag) {
@@ -559,11 +923,26 @@ allCyclesFlag, bool verboseFlag, int vertexToCheck) {
     //  non-traceable. 
     bitset exceptionalVertices = EMPTY;
 
+    //  Without -v it suffices to check one vertex of each orbit of the
+    //  automorphism group, since G - v and G - w are isomorphic if v and w are
+    //  in the same orbit.
+    int orbits[numberOfVertices];
+    if(!verboseFlag) {
+        int vertexColors[numberOfVertices];
+        for (int i = 0; i < numberOfVertices; i++) {
+            vertexColors[i] = 0;
+        }
+        computeOrbits(adjacencyList, numberOfVertices, vertexColors, orbits);
+    }
+
     //  Loop over all vertices and determine whether the vertex-deleted
     //  subgraph is traceable.
     for (int i = 0; i < numberOfVertices; i++) {
         bitset excludedVertices = singleton(i);
         if(!verboseFlag) {
+            if(orbits[i] != i) {
+                continue;
+            }
             if(!(isTraceable(adjacencyList,numberOfVertices,excludedVertices,
              false, false))) {
                 return false;
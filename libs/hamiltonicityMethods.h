@@ -8,6 +8,39 @@
 
 #include "bitset.h"
 
+/**
+ *  Returns the bitset of all vertices of the graph which have at least two
+ *  neighbours in the given set of vertices. Instead of counting the
+ *  neighbours of every vertex separately, the adjacency lists of the given
+ *  vertices are added to a saturating counter of two bitsets, containing the
+ *  vertices seen at least once and at least twice. This only uses operations
+ *  on whole bitsets.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  vertices    The vertices whose neighbours are counted.
+ *
+ *  @return The vertices having at least two neighbours in vertices.
+ * */
+bitset getVerticesWithTwoNeighboursIn(bitset adjacencyList[], bitset
+vertices);
+
+/**
+ *  Returns the candidates which have less than two neighbours in the given
+ *  set of vertices. When a vertex leaves the set during a search, only the
+ *  degrees of its neighbours change, so only these need to be checked
+ *  instead of all vertices.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  candidates  The vertices whose degree is checked.
+ *  @param  vertices    The vertices whose neighbours are counted.
+ *
+ *  @return The candidates having less than two neighbours in vertices.
+ * */
+bitset getVerticesWithLowDegreeIn(bitset adjacencyList[], bitset candidates,
+bitset vertices);
+
 /**
  *  Returns a boolean indicating whether or not the specified path can be
  *  extended to a hamiltonian cycle in the specified graph. The path is
@@ -161,6 +194,40 @@ verboseFlag, bool allCyclesFlag, int vertexToCheck);
 bool isK2Hamiltonian(bitset adjacencyList[], int numberOfVertices, bool
 verboseFlag, bool allCyclesFlag, int vertexPairToCheck[]);
 
+/**
+ *  Returns the same as isK1Hamiltonian without verboseFlag. Every cycle of
+ *  length n - 1 certifies that G - v is hamiltonian for the vertex v it
+ *  misses. Instead of throwing away the hamiltonian cycle found in G - v, we
+ *  swap v with the vertices of the cycle whose cycle neighbours are adjacent
+ *  to v. This yields cycles certifying other vertices, which are swapped
+ *  again. Only vertices which are not yet certified are checked separately.
+ * 
+ *  @param  adjacencyList   Array of bitsets representing the adjacency list
+ *   of the original graph.
+ *  @param  numberOfVertices The number of vertices in the original graph.
+ * 
+ *  @return True if the graph is K1-hamiltonian.
+ * */
+bool isK1HamiltonianByCertificates(bitset adjacencyList[], int
+numberOfVertices);
+
+/**
+ *  Returns the same as isK2Hamiltonian without verboseFlag. Every cycle of
+ *  length n - 2 certifies that G - v - w is hamiltonian if the two vertices
+ *  v, w it misses are adjacent. As in isK1HamiltonianByCertificates, the
+ *  cycle found in G - v - w is used to construct other such cycles by
+ *  swapping v or w, or both, with vertices of the cycle. Only edges which are
+ *  not yet certified are checked separately.
+ * 
+ *  @param  adjacencyList   Array of bitsets representing the adjacency list
+ *   of the original graph.
+ *  @param  numberOfVertices The number of vertices in the original graph.
+ * 
+ *  @return True if the graph is K2-hamiltonian.
+ * */
+bool isK2HamiltonianByCertificates(bitset adjacencyList[], int
+numberOfVertices);
+
 
 /**
  * Returns an integer indicating whether or not the (sub)graph contains a
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
 #include "readGraph6.h"
 #include "bitset.h"
 
@@ -46,11 +47,16 @@ int getNumberOfVertices(const char * graphString) {
 	//	third to eight characters and concatenate them to get the 36-bit
 	//	binary form of the number of vertices.
 	else if (graphString[++index] < 126) { // 258048 <= n <= 68719476735
-		int number = 0;
+		long long int number = 0;
 		for (int i = 5; i >= 0; i--) {
-			number |= (graphString[index++] - 63) << i*6;
+			number |= (long long int) (graphString[index++] - 63) << i*6;
 		}
-		return number;
+		if(number > INT_MAX) {
+			fprintf(stderr, "Error: Graphs with more than %d vertices are not"
+			 " supported.\n", INT_MAX);
+			return -1;
+		}
+		return (int) number;
 	}
 
 	else {
@@ -68,18 +74,20 @@ adjacencyList[]) {
 	if (graphString[startIndex] == '>') { // Skip >>graph6<< header.
 		startIndex += 10;
 	}
+	if (numberOfVertices > BITSETSIZE) {
+		fprintf(stderr,
+		 "Error: Program can only handle graphs with %d vertices or fewer.\n",
+		 BITSETSIZE);
+		return -1;
+	}
 	if (numberOfVertices <= 62) {
 		startIndex += 1;
 	}
-	else if (numberOfVertices <= BITSETSIZE) {
+	else if (numberOfVertices <= 258047) {
 		startIndex += 4;
 	}
-	//	BITSETSIZE will never get close to 258047.
 	else {
-		fprintf(stderr,
-		 "Error: Program can only handle graphs with %d vertices or fewer.\n",
-		 BITSETSIZE);
-		return -1;
+		startIndex += 8;
 	}
 
 	// Initialize adjacencyList.
@@ -0,0 +1,276 @@
+/**
+ * recognitionMethods.c
+ *
+ * A description of the methods can be found in the header file.
+ *
+ */
+
+#include <stdbool.h>
+#include "bitset.h"
+#include "recognitionMethods.h"
+
+//  Stores the vertices in the order in which they are visited by a
+//  lexicographic breadth-first search. The unvisited vertices are kept in an
+//  ordered partition. The next vertex is taken from the first cell and each
+//  cell is split into its neighbours of that vertex followed by the others.
+static void computeLexBFSOrdering(bitset adjacencyList[], int numberOfVertices,
+int ordering[]) {
+
+    bitset cells[BITSETSIZE];
+    bitset refinedCells[BITSETSIZE];
+    int numberOfCells = 1;
+    cells[0] = complement(EMPTY, numberOfVertices);
+
+    for(int i = 0; i < numberOfVertices; i++) {
+        int v = next(cells[0], -1);
+        removeElement(cells[0], v);
+        ordering[i] = v;
+
+        int numberOfRefinedCells = 0;
+        for(int c = 0; c < numberOfCells; c++) {
+            bitset neighbours = intersection(cells[c], adjacencyList[v]);
+            bitset nonNeighbours = difference(cells[c], adjacencyList[v]);
+            if(!isEmpty(neighbours)) {
+                refinedCells[numberOfRefinedCells++] = neighbours;
+            }
+            if(!isEmpty(nonNeighbours)) {
+                refinedCells[numberOfRefinedCells++] = nonNeighbours;
+            }
+        }
+        for(int c = 0; c < numberOfRefinedCells; c++) {
+            cells[c] = refinedCells[c];
+        }
+        numberOfCells = numberOfRefinedCells;
+    }
+}
+
+bool isChordal(bitset adjacencyList[], int numberOfVertices) {
+
+    if(numberOfVertices == 0) return true;
+
+    int ordering[numberOfVertices];
+    int position[numberOfVertices];
+    computeLexBFSOrdering(adjacencyList, numberOfVertices, ordering);
+    for(int i = 0; i < numberOfVertices; i++) {
+        position[ordering[i]] = i;
+    }
+
+    // The reverse ordering is a perfect elimination ordering if for each
+    // vertex v its earlier neighbours form a clique. It suffices to check that
+    // they are adjacent to the latest of them, which is then checked itself.
+    bitset visited = EMPTY;
+    for(int i = 0; i < numberOfVertices; i++) {
+        int v = ordering[i];
+        bitset earlierNeighbours = intersection(adjacencyList[v], visited);
+        add(visited, v);
+        if(isEmpty(earlierNeighbours)) continue;
+
+        int latest = next(earlierNeighbours, -1);
+        forEach(u, earlierNeighbours) {
+            if(position[u] > position[latest]) latest = u;
+        }
+        removeElement(earlierNeighbours, latest);
+        if(!isEmpty(difference(earlierNeighbours, adjacencyList[latest]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//  Returns the component of v in the subgraph induced by vertices, or in its
+//  complement if inComplement is true.
+static bitset getComponent(bitset adjacencyList[], bitset vertices, int v,
+bool inComplement) {
+    bitset component = singleton(v);
+    bitset newVertices = singleton(v);
+    while(!isEmpty(newVertices)) {
+        bitset neighbours = EMPTY;
+        forEach(u, newVertices) {
+            neighbours = union(neighbours, inComplement ?
+             difference(vertices, adjacencyList[u]) :
+             intersection(vertices, adjacencyList[u]));
+        }
+        newVertices = difference(neighbours, component);
+        component = union(component, newVertices);
+    }
+    return component;
+}
+
+//  Checks whether the subgraph induced by vertices is a cograph. It is split
+//  into a component and the remaining vertices, or into a component of its
+//  complement and the remaining vertices if it is connected.
+static bool isCographInducedBy(bitset adjacencyList[], bitset vertices) {
+    if(size(vertices) <= 1) return true;
+
+    int v = next(vertices, -1);
+    bitset component = getComponent(adjacencyList, vertices, v, false);
+    if(equals(component, vertices)) {
+        component = getComponent(adjacencyList, vertices, v, true);
+        if(equals(component, vertices)) return false;
+    }
+    return isCographInducedBy(adjacencyList, component) &&
+     isCographInducedBy(adjacencyList, difference(vertices, component));
+}
+
+bool isCograph(bitset adjacencyList[], int numberOfVertices) {
+    if(numberOfVertices == 0) return true;
+    return isCographInducedBy(adjacencyList,
+     complement(EMPTY, numberOfVertices));
+}
+
+bool isDisjointUnionOfCliques(bitset adjacencyList[], int numberOfVertices) {
+
+    // Adjacent vertices should have the same closed neighbourhood.
+    for(int v = 0; v < numberOfVertices; v++) {
+        bitset closedNeighbourhood = union(adjacencyList[v], singleton(v));
+        forEach(u, adjacencyList[v]) {
+            if(!equals(union(adjacencyList[u], singleton(u)),
+             closedNeighbourhood)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+struct blockSearch {
+    int discovered[BITSETSIZE];
+    int low[BITSETSIZE];
+    int parent[BITSETSIZE];
+    int lastNeighbour[BITSETSIZE];
+    int stack[BITSETSIZE];
+    int stackSize;
+    int time;
+    bool isCactus;
+    bitset cycleLengths;
+};
+
+//  Called when the depth-first search is done with w and returns to its parent
+//  v. If w was not connected to a proper ancestor of v, the vertices on the
+//  stack up to w form a block together with v, which is removed from the
+//  stack and checked to be an edge or a cycle, i.e. to have as many edges as
+//  vertices.
+static void finishVertex(bitset adjacencyList[], int v, int w,
+struct blockSearch *search) {
+    if(search->low[w] < search->low[v]) {
+        search->low[v] = search->low[w];
+    }
+    if(search->low[w] < search->discovered[v]) return;
+
+    bitset block = singleton(v);
+    int u;
+    do {
+        u = search->stack[--search->stackSize];
+        add(block, u);
+    } while(u != w);
+
+    int order = size(block);
+    if(order == 2) return;
+    int twiceNumberOfEdges = 0;
+    forEach(x, block) {
+        twiceNumberOfEdges += size(intersection(adjacencyList[x], block));
+    }
+    if(twiceNumberOfEdges != 2 * order) {
+        search->isCactus = false;
+        return;
+    }
+    add(search->cycleLengths, order);
+}
+
+//  Depth-first search from root computing the blocks of its component. The
+//  search is iterative, so that long paths do not overflow the call stack:
+//  the current path is followed back through parent and lastNeighbour holds
+//  for each vertex on it the last neighbour which was looked at.
+static void checkBlocks(bitset adjacencyList[], int root,
+struct blockSearch *search) {
+
+    search->discovered[root] = search->low[root] = ++search->time;
+    search->parent[root] = -1;
+    search->lastNeighbour[root] = -1;
+    search->stack[search->stackSize++] = root;
+
+    int v = root;
+    while(v != -1 && search->isCactus) {
+        int w = next(adjacencyList[v], search->lastNeighbour[v]);
+        if(w == -1) {
+            int parent = search->parent[v];
+            if(parent != -1) finishVertex(adjacencyList, parent, v, search);
+            v = parent;
+            continue;
+        }
+        search->lastNeighbour[v] = w;
+        if(search->discovered[w] == 0) {
+            search->discovered[w] = search->low[w] = ++search->time;
+            search->parent[w] = v;
+            search->lastNeighbour[w] = -1;
+            search->stack[search->stackSize++] = w;
+            v = w;
+        }
+        else if(w != search->parent[v] &&
+         search->discovered[w] < search->low[v]) {
+            search->low[v] = search->discovered[w];
+        }
+    }
+}
+
+bool isCactus(bitset adjacencyList[], int numberOfVertices,
+bitset *cycleLengths) {
+
+    struct blockSearch search;
+    search.stackSize = 0;
+    search.time = 0;
+    search.isCactus = true;
+    search.cycleLengths = EMPTY;
+    for(int v = 0; v < numberOfVertices; v++) {
+        search.discovered[v] = 0;
+    }
+    for(int v = 0; v < numberOfVertices && search.isCactus; v++) {
+        if(search.discovered[v] == 0) {
+            checkBlocks(adjacencyList, v, &search);
+            search.stackSize = 0;
+        }
+    }
+    *cycleLengths = search.cycleLengths;
+    return search.isCactus;
+}
+
+//  Returns the largest distance from v to a vertex in its component and stores
+//  a vertex at that distance in farthest. The set of vertices of the
+//  component is stored in component.
+static int getEccentricity(bitset adjacencyList[], int v, int *farthest,
+bitset *component) {
+    bitset visited = singleton(v);
+    bitset layer = singleton(v);
+    int distance = 0;
+    while(true) {
+        bitset nextLayer = EMPTY;
+        forEach(u, layer) {
+            nextLayer = union(nextLayer, adjacencyList[u]);
+        }
+        nextLayer = difference(nextLayer, visited);
+        if(isEmpty(nextLayer)) break;
+        visited = union(visited, nextLayer);
+        layer = nextLayer;
+        distance++;
+    }
+    *farthest = next(layer, -1);
+    *component = visited;
+    return distance;
+}
+
+int getForestDiameter(bitset adjacencyList[], int numberOfVertices) {
+    int diameter = 0;
+    bitset unvisited = EMPTY;
+    for(int v = 0; v < numberOfVertices; v++) {
+        add(unvisited, v);
+    }
+    while(!isEmpty(unvisited)) {
+        int end;
+        bitset component;
+        getEccentricity(adjacencyList, next(unvisited, -1), &end, &component);
+        int distance = getEccentricity(adjacencyList, end, &end, &component);
+        if(distance > diameter) diameter = distance;
+        unvisited = difference(unvisited, component);
+    }
+    return diameter;
+}
@@ -0,0 +1,86 @@
+/**
+ *  This header file contains functions for recognising graph classes in
+ *  which the longest induced cycle or path can be determined directly, so
+ *  that no exhaustive search is needed.
+ * */
+
+#ifndef RECOGNITION_METHODS
+#define RECOGNITION_METHODS
+
+#include <stdbool.h>
+#include "bitset.h"
+
+/**
+ *  Returns a boolean indicating whether the graph is chordal, i.e. contains
+ *  no induced cycle of length at least 4. An ordering is computed by
+ *  lexicographic breadth-first search, the graph is chordal if and only if
+ *  its reverse is a perfect elimination ordering.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *
+ *  @return True if the graph is chordal, false otherwise.
+ * */
+bool isChordal(bitset adjacencyList[], int numberOfVertices);
+
+/**
+ *  Returns a boolean indicating whether the graph is a cograph, i.e. contains
+ *  no induced path with 3 edges. A graph on at least two vertices is a
+ *  cograph if and only if it or its complement is disconnected and all
+ *  components are cographs, which is checked recursively.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *
+ *  @return True if the graph is a cograph, false otherwise.
+ * */
+bool isCograph(bitset adjacencyList[], int numberOfVertices);
+
+/**
+ *  Returns a boolean indicating whether every component of the graph is a
+ *  complete graph, i.e. whether it contains no induced path with 2 edges.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *
+ *  @return True if all components are complete, false otherwise.
+ * */
+bool isDisjointUnionOfCliques(bitset adjacencyList[], int numberOfVertices);
+
+/**
+ *  Returns a boolean indicating whether the graph is a cactus, i.e. whether
+ *  every block is an edge or a cycle. Forests and unicyclic graphs are cacti.
+ *  The blocks are found by a depth-first search. In a cactus every cycle is a
+ *  block, so it is induced.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *  @param  cycleLengths    Pointer to a bitset in which the lengths of the
+ *   cycles will be stored if the graph is a cactus. It is empty for forests.
+ *
+ *  @return True if the graph is a cactus, false otherwise.
+ * */
+bool isCactus(bitset adjacencyList[], int numberOfVertices,
+bitset *cycleLengths);
+
+/**
+ *  Returns the number of edges in a longest path of a forest, i.e. the
+ *  largest diameter of its trees. For each tree, a vertex farthest from any
+ *  vertex is an end of a longest path, so two breadth-first searches suffice.
+ *  For other graphs the same searches give the length of a shortest path, so
+ *  a lower bound for the diameter and for the longest induced path.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *
+ *  @return The length of a longest path of a forest, or a lower bound for the
+ *   diameter of another graph.
+ * */
+int getForestDiameter(bitset adjacencyList[], int numberOfVertices);
+
+#endif
@@ -0,0 +1,481 @@
+/**
+ * treeDecomposition.c
+ *
+ * A description of the methods can be found in the header file.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "bitset.h"
+#include "treeDecomposition.h"
+
+#define TD_MAX_BAG_SIZE (TD_MAX_WIDTH + 1)
+
+//  A state of the dynamic program is packed into 64 bits. For every position
+//  in the bag we store the degree (2 bits) of its vertex in the partial
+//  solution and, if this degree is 1, the position of the other end of its
+//  path (4 bits). The highest bit indicates that the partial solution is a
+//  closed cycle.
+#define BITS_PER_POSITION 6
+#define CLOSED_FLAG ((uint64_t) 1 << 63)
+#define EMPTY_KEY UINT64_MAX
+
+struct state {
+    int degree[TD_MAX_BAG_SIZE];
+    int partner[TD_MAX_BAG_SIZE];
+    bool closed;
+};
+
+//  Hash table mapping states to the largest number of vertices of degree 2
+//  among the forgotten vertices of a partial solution in that state.
+struct stateTable {
+    uint64_t *keys;
+    int *values;
+    int capacity;
+    int numberOfStates;
+};
+
+//******************************************************************************
+//
+//                          Elimination ordering
+//
+//******************************************************************************
+
+int computeEliminationOrdering(bitset adjacencyList[], int numberOfVertices,
+int maxWidth, int eliminationOrdering[]) {
+
+    bitset filledAdjacencyList[numberOfVertices];
+    for(int i = 0; i < numberOfVertices; i++) {
+        filledAdjacencyList[i] = adjacencyList[i];
+    }
+    bitset remainingVertices = complement(EMPTY, numberOfVertices);
+    int width = 0;
+
+    for(int i = 0; i < numberOfVertices; i++) {
+
+        // Find the remaining vertex of low degree creating the fewest fill
+        // edges when eliminated.
+        int bestVertex = -1;
+        int bestFill = -1;
+        int bestDegree = -1;
+        forEach(v, remainingVertices) {
+            int degree = size(filledAdjacencyList[v]);
+            if(degree > maxWidth) continue;
+
+            // Count the non-adjacent pairs of neighbours twice.
+            int fill = 0;
+            forEach(u, filledAdjacencyList[v]) {
+                fill += size(difference(filledAdjacencyList[v],
+                 union(filledAdjacencyList[u], singleton(u))));
+            }
+            if(bestVertex == -1 || fill < bestFill ||
+             (fill == bestFill && degree < bestDegree)) {
+                bestVertex = v;
+                bestFill = fill;
+                bestDegree = degree;
+            }
+        }
+
+        if(bestVertex == -1) {
+            return maxWidth + 1;
+        }
+        if(bestDegree > width) {
+            width = bestDegree;
+        }
+        eliminationOrdering[i] = bestVertex;
+
+        // Turn the neighbourhood into a clique and remove the vertex.
+        bitset neighbours = filledAdjacencyList[bestVertex];
+        forEach(u, neighbours) {
+            filledAdjacencyList[u] = union(filledAdjacencyList[u],
+             difference(neighbours, singleton(u)));
+            removeElement(filledAdjacencyList[u], bestVertex);
+        }
+        removeElement(remainingVertices, bestVertex);
+    }
+
+    return width;
+}
+
+//******************************************************************************
+//
+//                          States and state tables
+//
+//******************************************************************************
+
+static uint64_t encodeState(struct state *s, int bagSize) {
+    uint64_t key = s->closed ? CLOSED_FLAG : 0;
+    for(int i = 0; i < bagSize; i++) {
+        uint64_t partner = s->degree[i] == 1 ? s->partner[i] : 0;
+        key |= ((uint64_t) s->degree[i] | partner << 2) <<
+         (i * BITS_PER_POSITION);
+    }
+    return key;
+}
+
+static void decodeState(uint64_t key, struct state *s, int bagSize) {
+    s->closed = key & CLOSED_FLAG;
+    for(int i = 0; i < bagSize; i++) {
+        s->degree[i] = (key >> (i * BITS_PER_POSITION)) & 3;
+        s->partner[i] = (key >> (i * BITS_PER_POSITION + 2)) & 15;
+    }
+}
+
+static void initTable(struct stateTable *table, int capacity) {
+    table->capacity = capacity;
+    table->numberOfStates = 0;
+    table->keys = malloc(capacity * sizeof(uint64_t));
+    table->values = malloc(capacity * sizeof(int));
+    if(table->keys == NULL || table->values == NULL) {
+        fprintf(stderr, "Error: out of memory in tree decomposition.\n");
+        exit(1);
+    }
+    for(int i = 0; i < capacity; i++) {
+        table->keys[i] = EMPTY_KEY;
+    }
+}
+
+static void freeTable(struct stateTable *table) {
+    free(table->keys);
+    free(table->values);
+}
+
+static void insertState(struct stateTable *table, uint64_t key, int value);
+
+static void growTable(struct stateTable *table) {
+    struct stateTable old = *table;
+    initTable(table, 2 * old.capacity);
+    for(int i = 0; i < old.capacity; i++) {
+        if(old.keys[i] != EMPTY_KEY) {
+            insertState(table, old.keys[i], old.values[i]);
+        }
+    }
+    freeTable(&old);
+}
+
+//  Stores the state with the given value, unless the state is already present
+//  with a value that is at least as large.
+static void insertState(struct stateTable *table, uint64_t key, int value) {
+    if(2 * (table->numberOfStates + 1) > table->capacity) {
+        growTable(table);
+    }
+    int mask = table->capacity - 1;
+    int i = (int) ((key * 0x9E3779B97F4A7C15ULL) >> 40) & mask;
+    while(table->keys[i] != EMPTY_KEY) {
+        if(table->keys[i] == key) {
+            if(table->values[i] < value) {
+                table->values[i] = value;
+            }
+            return;
+        }
+        i = (i + 1) & mask;
+    }
+    table->keys[i] = key;
+    table->values[i] = value;
+    table->numberOfStates++;
+}
+
+//******************************************************************************
+//
+//                          Operations on states
+//
+//******************************************************************************
+
+//  Adds the edge between positions x and y to the partial solution. Returns
+//  false if the result is no longer a set of disjoint paths or a single cycle.
+static bool addEdgeToState(struct state *s, int x, int y, int bagSize) {
+    if(s->closed || s->degree[x] == 2 || s->degree[y] == 2) {
+        return false;
+    }
+
+    if(s->degree[x] == 0 && s->degree[y] == 0) {
+        s->partner[x] = y;
+        s->partner[y] = x;
+    }
+    else if(s->degree[y] == 0) {
+        int end = s->partner[x];
+        s->partner[end] = y;
+        s->partner[y] = end;
+    }
+    else if(s->degree[x] == 0) {
+        int end = s->partner[y];
+        s->partner[end] = x;
+        s->partner[x] = end;
+    }
+    else if(s->partner[x] == y) {
+
+        // The edge closes a path into a cycle. This is only allowed if it is
+        // the only path of the partial solution.
+        for(int i = 0; i < bagSize; i++) {
+            if(i != x && i != y && s->degree[i] == 1) {
+                return false;
+            }
+        }
+        s->closed = true;
+    }
+    else {
+        int endOfX = s->partner[x];
+        int endOfY = s->partner[y];
+        s->partner[endOfX] = endOfY;
+        s->partner[endOfY] = endOfX;
+    }
+    s->degree[x]++;
+    s->degree[y]++;
+    return true;
+}
+
+//  Combines two partial solutions on the same bag which use disjoint edge
+//  sets. Returns false if their union is not a set of disjoint paths or a
+//  single cycle.
+static bool joinStates(struct state *a, struct state *b, struct state *result,
+int bagSize) {
+    bool aIsEmpty = !a->closed;
+    bool bIsEmpty = !b->closed;
+    for(int i = 0; i < bagSize; i++) {
+        if(a->degree[i]) aIsEmpty = false;
+        if(b->degree[i]) bIsEmpty = false;
+    }
+    if(a->closed || b->closed) {
+        if(a->closed && b->closed) return false;
+        if(a->closed && !bIsEmpty) return false;
+        if(b->closed && !aIsEmpty) return false;
+        *result = a->closed ? *a : *b;
+        return true;
+    }
+
+    // Every end of a path in a or b is linked to the other end of that path.
+    int links[2][TD_MAX_BAG_SIZE];
+    bool visited[TD_MAX_BAG_SIZE] = {false};
+    result->closed = false;
+    for(int i = 0; i < bagSize; i++) {
+        result->degree[i] = a->degree[i] + b->degree[i];
+        if(result->degree[i] > 2) return false;
+        links[0][i] = a->degree[i] == 1 ? a->partner[i] : -1;
+        links[1][i] = b->degree[i] == 1 ? b->partner[i] : -1;
+    }
+
+    // Walk from each end of a path in the union to its other end.
+    bool hasPaths = false;
+    for(int i = 0; i < bagSize; i++) {
+        if(result->degree[i] != 1 || visited[i]) continue;
+        hasPaths = true;
+        int side = links[0][i] != -1 ? 0 : 1;
+        int current = i;
+        visited[i] = true;
+        while(true) {
+            current = links[side][current];
+            visited[current] = true;
+            if(result->degree[current] == 1) break;
+            side = 1 - side;
+        }
+        result->partner[i] = current;
+        result->partner[current] = i;
+    }
+
+    // Positions linked on both sides which were not visited lie on a cycle.
+    for(int i = 0; i < bagSize; i++) {
+        if(visited[i] || links[0][i] == -1 || links[1][i] == -1) continue;
+        if(hasPaths || result->closed) return false;
+        result->closed = true;
+        int side = 0;
+        int current = i;
+        do {
+            visited[current] = true;
+            current = links[side][current];
+            side = 1 - side;
+        } while(current != i);
+    }
+    return true;
+}
+
+//******************************************************************************
+//
+//                          Dynamic program
+//
+//******************************************************************************
+
+struct decomposition {
+    bitset *adjacencyList;
+    bitset *higherNeighbours;
+    int *firstChild;
+    int *nextSibling;
+    bool hamiltonianOnly;
+};
+
+static int getBag(bitset set, int bag[]) {
+    int bagSize = 0;
+    forEach(v, set) {
+        bag[bagSize++] = v;
+    }
+    return bagSize;
+}
+
+//  Computes the table of the subtree rooted at the bag of v after v has been
+//  forgotten. Its bag consists of the neighbours of v in the filled graph
+//  which are eliminated after v.
+static void processBag(struct decomposition *td, int v,
+struct stateTable *result) {
+
+    // Position 0 is v itself, followed by the higher neighbours.
+    int bag[TD_MAX_BAG_SIZE];
+    bag[0] = v;
+    int bagSize = 1 + getBag(td->higherNeighbours[v], bag + 1);
+
+    struct stateTable table;
+    initTable(&table, 16);
+    insertState(&table, 0, 0);
+
+    for(int child = td->firstChild[v]; child != -1;
+     child = td->nextSibling[child]) {
+        struct stateTable childTable;
+        processBag(td, child, &childTable);
+
+        // The bag of the child after forgetting it is a subset of our bag.
+        int childBag[TD_MAX_BAG_SIZE];
+        int childBagSize = getBag(td->higherNeighbours[child], childBag);
+        int positionInBag[TD_MAX_BAG_SIZE];
+        for(int i = 0; i < childBagSize; i++) {
+            for(int j = 0; j < bagSize; j++) {
+                if(bag[j] == childBag[i]) positionInBag[i] = j;
+            }
+        }
+
+        struct stateTable joinedTable;
+        initTable(&joinedTable, 16);
+        for(int i = 0; i < childTable.capacity; i++) {
+            if(childTable.keys[i] == EMPTY_KEY) continue;
+            struct state childState, liftedState;
+            decodeState(childTable.keys[i], &childState, childBagSize);
+            decodeState(0, &liftedState, bagSize);
+            liftedState.closed = childState.closed;
+            for(int k = 0; k < childBagSize; k++) {
+                liftedState.degree[positionInBag[k]] = childState.degree[k];
+                liftedState.partner[positionInBag[k]] =
+                 positionInBag[childState.partner[k]];
+            }
+
+            for(int j = 0; j < table.capacity; j++) {
+                if(table.keys[j] == EMPTY_KEY) continue;
+                struct state ownState, joinedState;
+                decodeState(table.keys[j], &ownState, bagSize);
+                if(joinStates(&ownState, &liftedState, &joinedState, bagSize)) {
+                    insertState(&joinedTable, encodeState(&joinedState, bagSize),
+                     table.values[j] + childTable.values[i]);
+                }
+            }
+        }
+        freeTable(&childTable);
+        freeTable(&table);
+        table = joinedTable;
+    }
+
+    // Forget v. All edges between v and vertices eliminated earlier have been
+    // decided in the subtrees, so we decide the edges to the rest of the bag.
+    int candidates[TD_MAX_BAG_SIZE];
+    int numberOfCandidates = 0;
+    for(int i = 1; i < bagSize; i++) {
+        if(contains(td->adjacencyList[v], bag[i])) {
+            candidates[numberOfCandidates++] = i;
+        }
+    }
+
+    initTable(result, 16);
+    for(int j = 0; j < table.capacity; j++) {
+        if(table.keys[j] == EMPTY_KEY) continue;
+        struct state s;
+        decodeState(table.keys[j], &s, bagSize);
+
+        // Try adding no edge (-1, -1), one edge (-1, i) or two edges (k, i).
+        for(int i = -1; i < numberOfCandidates; i++) {
+            for(int k = -1; k < i || k == -1; k++) {
+                struct state extended = s;
+                if(i != -1 && !addEdgeToState(&extended, 0, candidates[i],
+                 bagSize)) continue;
+                if(k != -1 && !addEdgeToState(&extended, 0, candidates[k],
+                 bagSize)) continue;
+
+                // A forgotten vertex is either not in the cycle or has both
+                // of its neighbours in the cycle.
+                if(extended.degree[0] == 1) continue;
+                if(td->hamiltonianOnly && extended.degree[0] != 2) continue;
+
+                struct state forgotten;
+                forgotten.closed = extended.closed;
+                for(int p = 1; p < bagSize; p++) {
+                    forgotten.degree[p - 1] = extended.degree[p];
+                    forgotten.partner[p - 1] = extended.partner[p] - 1;
+                }
+                insertState(result, encodeState(&forgotten, bagSize - 1),
+                 table.values[j] + (extended.degree[0] == 2));
+            }
+        }
+    }
+    freeTable(&table);
+}
+
+int getCircumferenceByTreeDecomposition(bitset adjacencyList[],
+int numberOfVertices, int eliminationOrdering[], bool hamiltonianOnly) {
+
+    int positionInOrdering[numberOfVertices];
+    for(int i = 0; i < numberOfVertices; i++) {
+        positionInOrdering[eliminationOrdering[i]] = i;
+    }
+
+    // Determine the bags by simulating the elimination. The parent of a bag
+    // is the bag of the neighbour which gets eliminated first.
+    bitset filledAdjacencyList[numberOfVertices];
+    bitset higherNeighbours[numberOfVertices];
+    int parent[numberOfVertices];
+    int firstChild[numberOfVertices];
+    int nextSibling[numberOfVertices];
+    for(int i = 0; i < numberOfVertices; i++) {
+        filledAdjacencyList[i] = adjacencyList[i];
+        firstChild[i] = -1;
+        nextSibling[i] = -1;
+    }
+    for(int i = 0; i < numberOfVertices; i++) {
+        int v = eliminationOrdering[i];
+        bitset neighbours = filledAdjacencyList[v];
+        higherNeighbours[v] = neighbours;
+        parent[v] = -1;
+        forEach(u, neighbours) {
+            if(parent[v] == -1 ||
+             positionInOrdering[u] < positionInOrdering[parent[v]]) {
+                parent[v] = u;
+            }
+            filledAdjacencyList[u] = union(filledAdjacencyList[u],
+             difference(neighbours, singleton(u)));
+            removeElement(filledAdjacencyList[u], v);
+        }
+        if(parent[v] != -1) {
+            nextSibling[v] = firstChild[parent[v]];
+            firstChild[parent[v]] = v;
+        }
+    }
+
+    struct decomposition td = {adjacencyList, higherNeighbours, firstChild,
+     nextSibling, hamiltonianOnly};
+
+    // Each root corresponds to a component of the graph.
+    int circumference = 0;
+    for(int v = 0; v < numberOfVertices; v++) {
+        if(parent[v] != -1) continue;
+        struct stateTable table;
+        processBag(&td, v, &table);
+        for(int i = 0; i < table.capacity; i++) {
+            if((table.keys[i] & CLOSED_FLAG) && table.keys[i] != EMPTY_KEY &&
+             table.values[i] > circumference) {
+                circumference = table.values[i];
+            }
+        }
+        freeTable(&table);
+    }
+
+    if(hamiltonianOnly && circumference != numberOfVertices) {
+        return 0;
+    }
+    return circumference;
+}
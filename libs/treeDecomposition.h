@@ -0,0 +1,59 @@
+/**
+ *  This header file contains functions for computing a heuristic tree
+ *  decomposition of a graph and for determining its circumference by dynamic
+ *  programming over this decomposition. The running time is exponential in
+ *  the width of the decomposition, but only linear in the order of the graph.
+ * */
+
+#ifndef TREE_DECOMPOSITION
+#define TREE_DECOMPOSITION
+
+#include <stdbool.h>
+#include "bitset.h"
+
+//  The largest width for which the dynamic program can be used. A bag then
+//  contains at most TD_MAX_WIDTH + 1 vertices.
+#define TD_MAX_WIDTH 9
+
+/**
+ *  Computes an elimination ordering of the graph using the min-fill
+ *  heuristic, where ties are broken by taking a vertex of lowest degree. Only
+ *  vertices whose degree in the partially eliminated graph is at most
+ *  maxWidth are considered. If no such vertex exists, the computation stops.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *  @param  maxWidth    The largest width we are interested in. Should be at
+ *   most TD_MAX_WIDTH.
+ *  @param  eliminationOrdering An array of numberOfVertices ints in which the
+ *   ordering will be stored.
+ *
+ *  @return The width of the tree decomposition induced by the ordering or
+ *   maxWidth + 1 if no ordering of width at most maxWidth was found.
+ * */
+int computeEliminationOrdering(bitset adjacencyList[], int numberOfVertices,
+int maxWidth, int eliminationOrdering[]);
+
+/**
+ *  Returns the length of a longest cycle in the graph, computed by dynamic
+ *  programming over the tree decomposition induced by the given elimination
+ *  ordering. Every bag stores, for each of its vertices, the degree in the
+ *  partial solution and which ends of the partial paths belong together.
+ *
+ *  @param  adjacencyList   An array of bitsets representing the adjacency
+ *   list of the graph.
+ *  @param  numberOfVertices    The number of vertices in the graph.
+ *  @param  eliminationOrdering An elimination ordering of the graph of width
+ *   at most TD_MAX_WIDTH, e.g. computed by computeEliminationOrdering.
+ *  @param  hamiltonianOnly Boolean which if true only looks for hamiltonian
+ *   cycles. This prunes the dynamic program considerably.
+ *
+ *  @return The length of a longest cycle in the graph or 0 if the graph is
+ *   acyclic. If hamiltonianOnly is true, numberOfVertices if the graph is
+ *   hamiltonian and 0 otherwise.
+ * */
+int getCircumferenceByTreeDecomposition(bitset adjacencyList[],
+int numberOfVertices, int eliminationOrdering[], bool hamiltonianOnly);
+
+#endif
@@ -0,0 +1,69 @@
+#!/bin/sh
+# Checks the circumference and length of the graphs in tests/regression.txt
+# for every binary given as argument. Run it with `make test` from the root of
+# the repository. Every line of regression.txt contains a graph in graph6
+# format followed by its circumference and length, lines starting with # are
+# skipped. Each graph is checked with several combinations of options, which
+# all take a different path through the search.
+#
+# The induced searches and -B are also run on the graph without vertices.
+# The K1- and K2-hamiltonicity checks of -1 and -2 are also compared with and
+# without -x on the graphs in tests/hamiltonicity.g6, which contains graphs
+# for which the answers differ.
+
+failures=0
+
+check() {
+    binary=$1
+    options=$2
+    graph=$3
+    value=$4
+    output=$(printf '%s\n' "$graph" | ./$binary $options -o$value 2>/dev/null)
+    if [ "$output" != "$graph" ]; then
+        echo "FAIL: $binary $options on $graph should give $value"
+        failures=$((failures + 1))
+    fi
+}
+
+for binary in "$@"; do
+    while read -r graph circumference length description; do
+        case $graph in
+            ""|\#*) continue ;;
+        esac
+        for options in "" "-S" "-t-1" "-S -t-1" "-H"; do
+            check "$binary" "$options" "$graph" "$circumference"
+        done
+        for options in "-l" "-l -S" "-l -t-1" "-l -S -t-1" "-l -H" \
+         "-l -t0"; do
+            check "$binary" "$options" "$graph" "$length"
+        done
+    done < tests/regression.txt
+done
+
+# The graph without vertices has no induced cycles or paths and is Berge.
+for binary in "$@"; do
+    for options in "-c" "-c -G" "-p" "-p -G"; do
+        check "$binary" "$options" "?" 0
+    done
+    check "$binary" "-B" "?" 1
+    check "$binary" "-B -G" "?" 1
+done
+
+for binary in "$@"; do
+    for options in "-1" "-2"; do
+        expected=$(./$binary $options < tests/hamiltonicity.g6 2>&1 |
+         grep -v Checked)
+        output=$(./$binary $options -x < tests/hamiltonicity.g6 2>&1 |
+         grep -v Checked)
+        if [ "$output" != "$expected" ]; then
+            echo "FAIL: $binary $options -x differs from $binary $options"
+            failures=$((failures + 1))
+        fi
+    done
+done
+
+if [ $failures -ne 0 ]; then
+    echo "$failures checks failed."
+    exit 1
+fi
+echo "All checks passed."